@@ -1,12 +1,17 @@
 #include "AnimatedSprite.h"
 
+#include "../Util/Debug.h"
+
 namespace metalwalrus
 {
 	AnimatedSprite::AnimatedSprite(SpriteSheet *animationSheet)
 	{
 		this->animationSheet = animationSheet;
 		this->isAnimating = false;
+		this->currentAnimation = NO_ANIMATION;
 		this->loop = false;
+		this->currentFrameCounter = 0;
+		this->reverse = false;
 	}
 
 	AnimatedSprite::AnimatedSprite(const AnimatedSprite& other)
@@ -14,9 +19,12 @@ namespace metalwalrus
 		this->animationSheet = other.animationSheet;
 		this->isAnimating = other.isAnimating;
 		this->animations = other.animations;
+		this->animationNames = other.animationNames;
 		this->currentAnimation = other.currentAnimation;
 		this->loop = other.loop;
 		this->animationQueue = other.animationQueue;
+		this->currentFrameCounter = other.currentFrameCounter;
+		this->reverse = other.reverse;
 	}
 
 	AnimatedSprite& AnimatedSprite::operator=(const AnimatedSprite& other)
@@ -26,118 +34,183 @@ namespace metalwalrus
 			this->animationSheet = other.animationSheet;
 			this->isAnimating = other.isAnimating;
 			this->animations = other.animations;
+			this->animationNames = other.animationNames;
 			this->currentAnimation = other.currentAnimation;
 			this->loop = other.loop;
 			this->animationQueue = other.animationQueue;
+			this->currentFrameCounter = other.currentFrameCounter;
+			this->reverse = other.reverse;
 		}
 		return *this;
 	}
 
-	std::vector<std::string> AnimatedSprite::get_animations()
+	AnimationID AnimatedSprite::findAnimation(const std::string& name) const
+	{
+		for (int i = 0; i < (int)animationNames.size(); i++)
+		{
+			if (animationNames[i] == name)
+				return i;
+		}
+		return NO_ANIMATION;
+	}
+
+	bool AnimatedSprite::checkAnimation(AnimationID anim) const
 	{
-		std::vector<std::string> returnVal;
-		for (auto anim : animations)
-			returnVal.push_back(anim.first);
-		return returnVal;
+		if (anim >= 0 && anim < (int)animations.size())
+			return true;
+		LOG_ERROR("Tried to play animation %d of %d", anim, (int)animations.size());
+		return false;
+	}
+
+	AnimationID AnimatedSprite::get_animationID(const std::string& name) const
+	{
+		AnimationID anim = findAnimation(name);
+		if (anim == NO_ANIMATION)
+			LOG_ERROR("Unknown animation clip %s", name.c_str());
+		return anim;
+	}
+
+	AnimationID AnimatedSprite::addAnimation(const std::string& name, FrameAnimation anim)
+	{
+		AnimationID existing = findAnimation(name);
+		if (existing != NO_ANIMATION)
+		{
+			animations[existing] = anim;
+			return existing;
+		}
+
+		animations.push_back(anim);
+		animationNames.push_back(name);
+		return animations.size() - 1;
 	}
 
-	void AnimatedSprite::addAnimation(std::string name, FrameAnimation anim)
+	void AnimatedSprite::chainAnimation(AnimationID anim, AnimationID next)
 	{
-		animations.insert(std::make_pair(name, anim));
+		if (!checkAnimation(anim) || !checkAnimation(next))
+			return;
+		this->animations[anim].set_nextAnimation(next);
 	}
 
-	void AnimatedSprite::playOneShot(std::string name)
+	void AnimatedSprite::playOneShot(AnimationID anim)
 	{
-		this->animations[currentAnimation].resetToFirstFrame();
+		if (!checkAnimation(anim))
+			return;
+		if (currentAnimation != NO_ANIMATION)
+			this->animations[currentAnimation].resetToFirstFrame();
 		this->currentFrameCounter = 0;
-		this->currentAnimation = name;
+		this->currentAnimation = anim;
 		this->isAnimating = true;
 		this->loop = false;
 		this->reverse = false;
 	}
 
-	void AnimatedSprite::playOneShot(std::string name, std::function<void()> onFinish)
+	void AnimatedSprite::playOneShot(AnimationID anim, std::function<void()> onFinish)
 	{
-		this->animations[name].registerOnFinish(onFinish);
-		this->playOneShot(name);
+		if (!checkAnimation(anim))
+			return;
+		this->animations[anim].registerOnFinish(onFinish);
+		this->playOneShot(anim);
 	}
 
-	void AnimatedSprite::playOneShotReverse(std::string name)
+	void AnimatedSprite::playOneShotReverse(AnimationID anim)
 	{
+		if (!checkAnimation(anim))
+			return;
 		this->reverse = true;
-		this->animations[currentAnimation].resetToLastFrame();
+		if (currentAnimation != NO_ANIMATION)
+			this->animations[currentAnimation].resetToLastFrame();
 		this->currentFrameCounter = 0;
-		this->currentAnimation = name;
+		this->currentAnimation = anim;
 		this->isAnimating = true;
 		this->loop = false;
 	}
 
-	void AnimatedSprite::playOneShotReverse(std::string name, std::function<void()> onFinish)
+	void AnimatedSprite::playOneShotReverse(AnimationID anim, std::function<void()> onFinish)
 	{
-		this->animations[name].registerOnFinish(onFinish);
-		this->playOneShotReverse(name);
+		if (!checkAnimation(anim))
+			return;
+		this->animations[anim].registerOnFinish(onFinish);
+		this->playOneShotReverse(anim);
 	}
 
-	void AnimatedSprite::play(std::string name)
+	void AnimatedSprite::play(AnimationID anim)
 	{
-		if (currentAnimation == name) return;
+		if (!checkAnimation(anim))
+			return;
+		if (currentAnimation == anim) return;
 		this->currentFrameCounter = 0;
-		this->animations[currentAnimation].resetToFirstFrame();
-		this->currentAnimation = name;
+		if (currentAnimation != NO_ANIMATION)
+			this->animations[currentAnimation].resetToFirstFrame();
+		this->currentAnimation = anim;
 		this->isAnimating = true;
 		this->loop = true;
 		this->reverse = false;
 	}
 
-	void AnimatedSprite::play(std::string name, std::function<void()> onLoop)
+	void AnimatedSprite::play(AnimationID anim, std::function<void()> onLoop)
 	{
-		if (currentAnimation == name) return;
-		this->animations[name].registerOnFinish(onLoop);
-		this->play(name);
+		if (!checkAnimation(anim))
+			return;
+		if (currentAnimation == anim) return;
+		this->animations[anim].registerOnFinish(onLoop);
+		this->play(anim);
 	}
 
-	void AnimatedSprite::playReverse(std::string name)
+	void AnimatedSprite::playReverse(AnimationID anim)
 	{
-		if (currentAnimation == name) return;
+		if (!checkAnimation(anim))
+			return;
+		if (currentAnimation == anim) return;
 		this->currentFrameCounter = 0;
-		this->animations[currentAnimation].resetToLastFrame();
-		this->currentAnimation = name;
+		if (currentAnimation != NO_ANIMATION)
+			this->animations[currentAnimation].resetToLastFrame();
+		this->currentAnimation = anim;
 		this->isAnimating = true;
 		this->loop = true;
 		this->reverse = true;
 	}
 
-	void AnimatedSprite::playReverse(std::string name, std::function<void()> onLoop)
+	void AnimatedSprite::playReverse(AnimationID anim, std::function<void()> onLoop)
 	{
-		if (currentAnimation == name) return;
-		this->animations[name].registerOnFinish(onLoop);
-		this->playReverse(name);
+		if (!checkAnimation(anim))
+			return;
+		if (currentAnimation == anim) return;
+		this->animations[anim].registerOnFinish(onLoop);
+		this->playReverse(anim);
 	}
 
-	void AnimatedSprite::playAtFrame(std::string name, int frame)
+	void AnimatedSprite::playAtFrame(AnimationID anim, int frame)
 	{
-		this->animations[name].set_currentFrameRelative(frame);
-		this->play(name);
+		if (!checkAnimation(anim))
+			return;
+		this->animations[anim].set_currentFrameRelative(frame);
+		this->play(anim);
 		this->reverse = false;
 	}
 
-	void AnimatedSprite::playAtFrame(std::string name, int frame, std::function<void()> onLoop)
+	void AnimatedSprite::playAtFrame(AnimationID anim, int frame, std::function<void()> onLoop)
 	{
-		this->animations[name].set_currentFrameRelative(frame);
-		this->play(name, onLoop);
+		if (!checkAnimation(anim))
+			return;
+		this->animations[anim].set_currentFrameRelative(frame);
+		this->play(anim, onLoop);
 		this->reverse = false;
 	}
 
-	void AnimatedSprite::playForFrames(std::string name, int frames)
+	void AnimatedSprite::playForFrames(AnimationID anim, int frames)
 	{
-		this->play(name);
+		if (!checkAnimation(anim))
+			return;
+		this->play(anim);
 		currentFrameCounter = frames;
 		this->reverse = false;
 	}
 
-	void AnimatedSprite::playForFrames(std::string name, int frames, std::function<void()> onFinish)
+	void AnimatedSprite::playForFrames(AnimationID anim, int frames, std::function<void()> onFinish)
 	{
-		this->play(name, onFinish);
+		if (!checkAnimation(anim))
+			return;
+		this->play(anim, onFinish);
 		currentFrameCounter = frames;
 		this->reverse = false;
 	}
@@ -145,7 +218,8 @@ namespace metalwalrus
 	void AnimatedSprite::stop()
 	{
 		this->isAnimating = false;
-		this->animations[currentAnimation].resetToFirstFrame();
+		if (currentAnimation != NO_ANIMATION)
+			this->animations[currentAnimation].resetToFirstFrame();
 	}
 
 	void AnimatedSprite::pause()
@@ -158,25 +232,29 @@ namespace metalwalrus
 		this->isAnimating = true;
 	}
 
-	void AnimatedSprite::queue(std::string name, std::function<void()> onFinish)
+	void AnimatedSprite::queue(AnimationID anim, std::function<void()> onFinish)
 	{
-		this->animationQueue.push(name);
-		this->animations[name].registerOnFinish(onFinish);
+		if (!checkAnimation(anim))
+			return;
+		this->animationQueue.push(anim);
+		this->animations[anim].registerOnFinish(onFinish);
 	}
 
-	void AnimatedSprite::queue(std::string name)
+	void AnimatedSprite::queue(AnimationID anim)
 	{
-		this->animationQueue.push(name);
+		if (!checkAnimation(anim))
+			return;
+		this->animationQueue.push(anim);
 	}
 
 	void AnimatedSprite::update(double delta)
 	{
 		if (!isAnimating)
 			return;
-		if (currentAnimation.empty())
+		if (currentAnimation == NO_ANIMATION)
 			return;
 
-		auto current = &animations[currentAnimation];
+		FrameAnimation *current = &animations[currentAnimation];
 
 		current->update(delta, this->reverse);
 
@@ -211,6 +289,8 @@ namespace metalwalrus
 
 	TextureRegion *AnimatedSprite::get_keyframe()
 	{
+		if (currentAnimation == NO_ANIMATION)
+			return nullptr; // nothing played yet, or the clip didn't load
 		return animationSheet->get_sprite(
 			animations[currentAnimation].get_currentFrame());
 	}
@@ -2,7 +2,8 @@
 #define ANIMATEDSPRITE_H
 #pragma once
 
-#include <map>
+#include <string>
+#include <vector>
 #include <queue>
 #include <functional>
 
@@ -15,13 +16,16 @@ namespace metalwalrus
 	{
 		SpriteSheet *animationSheet;
 		bool isAnimating;
-		std::map<std::string, FrameAnimation> animations;
-		std::string currentAnimation;
-		std::queue<std::string> animationQueue;
+		std::vector<FrameAnimation> animations; // clip table, indexed by AnimationID
+		std::vector<std::string> animationNames; // parallel to animations, used at load time
+		AnimationID currentAnimation;
+		std::queue<AnimationID> animationQueue;
 		bool loop;
 		int currentFrameCounter;
 		bool reverse;
 
+		AnimationID findAnimation(const std::string& name) const;
+		bool checkAnimation(AnimationID anim) const; // logs an error if anim isn't a clip
 	public:
 		AnimatedSprite(SpriteSheet* animationSheet);
 		AnimatedSprite(const AnimatedSprite& other);
@@ -32,31 +36,37 @@ namespace metalwalrus
 		bool get_looping() const { return loop; }
 		void set_looping(bool looping) { this->loop = looping; }
 
-		FrameAnimation get_currentAnim() const { return this->animations.at(currentAnimation); }
+		const FrameAnimation& get_currentAnim() const { return this->animations[currentAnimation]; }
+		AnimationID get_currentAnimID() const { return currentAnimation; }
 
-		std::vector<std::string> get_animations();
+		int get_animationCount() const { return animations.size(); }
+		const std::string& get_animationName(AnimationID anim) const { return animationNames[anim]; }
+		// NO_ANIMATION, with an error logged, if there's no clip called name
+		AnimationID get_animationID(const std::string& name) const;
 
-		void addAnimation(std::string name, FrameAnimation anim);
+		AnimationID addAnimation(const std::string& name, FrameAnimation anim);
+		void chainAnimation(AnimationID anim, AnimationID next);
 
-		void playOneShot(std::string name);
-		void playOneShot(std::string name, std::function<void()> onFinish);
-		void playOneShotReverse(std::string name);
-		void playOneShotReverse(std::string name, std::function<void()> onFinish);
-		void play(std::string name);
-		void play(std::string name, std::function<void()> onLoop);
-		void playReverse(std::string name);
-		void playReverse(std::string name, std::function<void()> onLoop);
-		void playAtFrame(std::string name, int frame);
-		void playAtFrame(std::string name, int frame, std::function<void()> onLoop);
-		void playForFrames(std::string name, int frames);
-		void playForFrames(std::string name, int frames, std::function<void()> onFinish);
+		void playOneShot(AnimationID anim);
+		void playOneShot(AnimationID anim, std::function<void()> onFinish);
+		void playOneShotReverse(AnimationID anim);
+		void playOneShotReverse(AnimationID anim, std::function<void()> onFinish);
+		void play(AnimationID anim);
+		void play(AnimationID anim, std::function<void()> onLoop);
+		void playReverse(AnimationID anim);
+		void playReverse(AnimationID anim, std::function<void()> onLoop);
+		void playAtFrame(AnimationID anim, int frame);
+		void playAtFrame(AnimationID anim, int frame, std::function<void()> onLoop);
+		void playForFrames(AnimationID anim, int frames);
+		void playForFrames(AnimationID anim, int frames, std::function<void()> onFinish);
 		void stop();
 		void pause();
 		void resume();
-		void queue(std::string name);
-		void queue(std::string name, std::function<void()> onFinish);
+		void queue(AnimationID anim);
+		void queue(AnimationID anim, std::function<void()> onFinish);
 
 		void update(double delta);
+		// nullptr until a clip is playing
 		TextureRegion *get_keyframe();
 	};
 }
@@ -6,6 +6,10 @@
 
 namespace metalwalrus
 {
+	// handle to an animation clip, index into an AnimatedSprite's clip table
+	typedef int AnimationID;
+	const AnimationID NO_ANIMATION = -1;
+
 	class FrameAnimation
 	{
 		int frameCount = 1;
@@ -14,7 +18,7 @@ namespace metalwalrus
 		int currentFrame;
 		float frameTimer = 0;
 		int playCount = 0;
-		std::string nextAnimation;
+		AnimationID nextAnimation = NO_ANIMATION;
 		std::function<void()> onFinish;
 		bool finished = false;
 
@@ -33,9 +37,9 @@ namespace metalwalrus
 	public:
 		FrameAnimation()
 			: frameCount(1), startFrame(0), frameLength(1), currentFrame(startFrame),
-			frameTimer(0), playCount(0), finished(false) { }
+			frameTimer(0), playCount(0), nextAnimation(NO_ANIMATION), finished(false) { }
 		FrameAnimation(int frameCount, int startFrame, float frameLength, 
-			std::string nextAnimation = "")
+			AnimationID nextAnimation = NO_ANIMATION)
 			: frameCount(frameCount), startFrame(startFrame),
 			frameLength(frameLength), currentFrame(startFrame),
 			frameTimer(0), nextAnimation(nextAnimation) { }
@@ -71,8 +75,9 @@ namespace metalwalrus
 		int get_currentFrameRelative() const { return currentFrame - startFrame; }
 		void set_currentFrameRelative(int frame) { currentFrame = startFrame + frame; }
 		int get_playCount() const { return playCount; }
-		std::string get_nextAnimation() const { return nextAnimation; }
-		bool has_next() const { return !nextAnimation.empty(); }
+		AnimationID get_nextAnimation() const { return nextAnimation; }
+		void set_nextAnimation(AnimationID next) { nextAnimation = next; }
+		bool has_next() const { return nextAnimation != NO_ANIMATION; }
 		bool is_finished() const { return finished; }
 
 		void registerOnFinish(std::function<void()> callback) { onFinish = callback; }
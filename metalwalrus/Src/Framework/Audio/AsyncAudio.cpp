@@ -0,0 +1,126 @@
+#include "AsyncAudio.h"
+
+#include <chrono>
+
+#include "../Util/Debug.h"
+
+namespace metalwalrus
+{
+	AsyncAudio::AsyncAudio(Audio *backend)
+		: backend(backend), epoch(0), dropped(0), stalls(0), highWater(0)
+	{
+		this->thread = std::thread(&AsyncAudio::threadLoop, this);
+	}
+
+	AsyncAudio::~AsyncAudio()
+	{
+		Command quit = { Command::Type::QUIT };
+		push(quit, false);
+		thread.join();
+		delete backend;
+	}
+
+	void AsyncAudio::push(Command& command, bool mayDrop)
+	{
+		command.epoch = epoch.load(std::memory_order_relaxed);
+		while (!commands.push(std::move(command)))
+		{
+			// losing a one-shot sound is better than stalling the tick, but
+			// loads, stops and the quit have to get through
+			if (mayDrop)
+			{
+				dropped++;
+				return;
+			}
+			stalls++;
+			wake.notify_one();
+			std::this_thread::yield();
+		}
+
+		unsigned size = commands.size();
+		if (size > highWater)
+			highWater = size;
+	}
+
+	void AsyncAudio::preload(SoundID sound, const std::string& path, int maxVoices)
+	{
+		Command load = { Command::Type::LOAD, sound, maxVoices };
+		load.path = path;
+		push(load, false);
+	}
+
+	void AsyncAudio::playSound(SoundID sound, float pan)
+	{
+		Command play = { Command::Type::PLAY, sound, 0, false, pan };
+		push(play, true);
+	}
+
+	void AsyncAudio::playSound(const char *sound, bool loop)
+	{
+		Command stream = { Command::Type::STREAM, Audio::NO_SOUND, 0, loop };
+		stream.path = sound;
+		push(stream, false);
+	}
+
+	void AsyncAudio::stopAllSounds()
+	{
+		// anything queued before this belongs to the old scene
+		epoch++;
+		Command stop = { Command::Type::STOP_ALL };
+		push(stop, false);
+		wake.notify_one();
+	}
+
+	void AsyncAudio::update()
+	{
+		Command update = { Command::Type::UPDATE };
+		push(update, false);
+		wake.notify_one();
+	}
+
+	void AsyncAudio::execute(Command& command, unsigned currentEpoch)
+	{
+		switch (command.type)
+		{
+		case Command::Type::LOAD:
+			// both sides hand out IDs in load order, so they always agree
+			if (backend->loadSound(command.path, command.maxVoices) != command.sound)
+				LOG_ERROR("Sound ID mismatch loading %s", command.path.c_str());
+			break;
+		case Command::Type::PLAY:
+			if (command.epoch == currentEpoch)
+				backend->playSound(command.sound, command.pan);
+			break;
+		case Command::Type::STREAM:
+			if (command.epoch == currentEpoch)
+				backend->playSound(command.path.c_str(), command.loop);
+			break;
+		case Command::Type::STOP_ALL:
+			backend->stopAllSounds();
+			break;
+		case Command::Type::UPDATE:
+			backend->update();
+			break;
+		default:
+			break;
+		}
+	}
+
+	void AsyncAudio::threadLoop()
+	{
+		Command command;
+		while (true)
+		{
+			while (commands.pop(command))
+			{
+				if (command.type == Command::Type::QUIT)
+					return;
+				execute(command, epoch.load(std::memory_order_acquire));
+			}
+
+			// woken once a tick by update, the timeout covers a missed notify
+			std::unique_lock<std::mutex> lock(sleepLock);
+			wake.wait_for(lock, std::chrono::milliseconds(5));
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#ifndef ASYNCAUDIO_H
+#define ASYNCAUDIO_H
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Audio.h"
+#include "../Util/SPSCQueue.h"
+
+namespace metalwalrus
+{
+	// runs another audio service on its own thread. calls from the game
+	// become commands in a lock free queue, which the audio thread drains
+	// every tick, so a slow backend can't stall the simulation. only the
+	// thread that created it may call it
+	class AsyncAudio : public Audio
+	{
+		struct Command
+		{
+			enum class Type
+			{
+				LOAD,
+				PLAY,
+				STREAM,
+				STOP_ALL,
+				UPDATE,
+				QUIT
+			};
+
+			Type type;
+			SoundID sound;
+			int maxVoices;
+			bool loop;
+			float pan;
+			unsigned epoch; // plays from before the last flush are skipped
+			std::string path;
+		};
+
+		static const unsigned queueSize = 1024;
+
+		Audio *backend; // owned, only touched by the audio thread
+		SPSCQueue<Command, queueSize> commands;
+		std::thread thread;
+		std::mutex sleepLock;
+		std::condition_variable wake;
+		std::atomic<unsigned> epoch;
+
+		int dropped; // plays lost because the queue was full
+		int stalls; // commands that had to wait for space
+		unsigned highWater;
+
+		void push(Command& command, bool mayDrop);
+		void execute(Command& command, unsigned currentEpoch);
+		void threadLoop();
+	protected:
+		virtual void preload(SoundID sound, const std::string& path, int maxVoices) override;
+	public:
+		AsyncAudio(Audio *backend);
+		~AsyncAudio();
+
+		virtual void playSound(SoundID sound, float pan = 0) override;
+		virtual void playSound(const char* sound, bool loop = false) override;
+		// drops any sounds still queued and stops everything playing
+		virtual void stopAllSounds() override;
+		virtual void update() override;
+
+		int get_dropped() const { return dropped; }
+		int get_stalls() const { return stalls; }
+		unsigned get_highWater() const { return highWater; }
+	};
+}
+
+#endif // ASYNCAUDIO_H
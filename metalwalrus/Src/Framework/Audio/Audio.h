@@ -2,15 +2,47 @@
 #define AUDIO_H
 #pragma once
 
+#include <map>
+#include <string>
+
 namespace metalwalrus
 {
+	// handle to a preloaded sound, index into the service's sound bank
+	typedef int SoundID;
+
 	class Audio
 	{
+		std::map<std::string, SoundID> soundIDs;
+	protected:
+		// load the sound into memory ready to be played by ID
+		virtual void preload(SoundID sound, const std::string& path, int maxVoices) = 0;
 	public:
+		static const SoundID NO_SOUND = -1;
+
 		virtual ~Audio() {}
+
+		// loading the same path again returns the existing handle. maxVoices
+		// is how many copies of the sound may play at once
+		SoundID loadSound(const std::string& path, int maxVoices = 4)
+		{
+			auto it = soundIDs.find(path);
+			if (it != soundIDs.end())
+				return it->second;
+
+			SoundID id = soundIDs.size();
+			soundIDs[path] = id;
+			this->preload(id, path, maxVoices);
+			return id;
+		}
+
+		// pan from -1 (left) to 1 (right)
+		virtual void playSound(SoundID sound, float pan = 0) = 0;
+		// streamed from disk, for music
 		virtual void playSound(const char* sound, bool loop = false) = 0;
 		virtual void stopAllSounds() = 0;
+		// called once per tick after the scenes have updated
+		virtual void update() = 0;
 	};
 }
 
-#endif // AUDIO_H
\ No newline at end of file
+#endif // AUDIO_H
@@ -0,0 +1,24 @@
+#ifndef AUDIOSINK_H
+#define AUDIOSINK_H
+#pragma once
+
+namespace metalwalrus
+{
+	// where the software mixer sends its output, blocks of interleaved
+	// stereo float frames
+	class AudioSink
+	{
+	public:
+		virtual ~AudioSink() { }
+		virtual void write(const float *frames, int count) = 0;
+	};
+
+	// throws the audio away, for timing the mixer
+	class NullSink : public AudioSink
+	{
+	public:
+		virtual void write(const float *frames, int count) override { }
+	};
+}
+
+#endif // AUDIOSINK_H
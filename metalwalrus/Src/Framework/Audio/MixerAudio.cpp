@@ -0,0 +1,238 @@
+#include "MixerAudio.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MIXER_SSE
+#include <xmmintrin.h>
+#endif
+
+#include "../Util/Debug.h"
+
+namespace metalwalrus
+{
+	MixerAudio::MixerAudio(AudioSink *sink, int ticksPerSecond)
+		: sink(sink), pendingFrames(0), droppedVoices(0)
+	{
+		this->framesPerTick = (double)SAMPLE_RATE / ticksPerSecond;
+		for (int i = MAX_VOICES - 1; i >= 0; i--)
+		{
+			voices[i].active = false;
+			voices[i].source = -1;
+			freeVoices.push_back(i);
+		}
+	}
+
+	MixerAudio::~MixerAudio()
+	{
+		delete sink;
+	}
+
+	void MixerAudio::preload(SoundID sound, const std::string& path, int maxVoices)
+	{
+		int source = -1;
+		PCMData data;
+		if (data.loadWav(path, SAMPLE_RATE))
+		{
+			source = pcm.size();
+			pcm.push_back(std::move(data));
+		}
+
+		if (sound >= soundSources.size())
+			soundSources.resize(sound + 1, -1);
+		soundSources[sound] = source;
+		bank.add(sound, maxVoices);
+	}
+
+	int MixerAudio::startVoice(int source, bool loop, float pan)
+	{
+		if (freeVoices.size() == 0)
+		{
+			droppedVoices++;
+			return -1;
+		}
+
+		int index = freeVoices.back();
+		freeVoices.pop_back();
+
+		Voice& v = voices[index];
+		v.source = source;
+		v.position = 0;
+		v.loop = loop;
+		v.active = true;
+		panGains(1, std::max(-1.0f, std::min(pan, 1.0f)), v.gainLeft, v.gainRight);
+		return index;
+	}
+
+	void MixerAudio::playSound(SoundID sound, float pan)
+	{
+		if (sound < 0 || sound >= soundSources.size() || soundSources[sound] == -1)
+			return;
+		if (!bank.beginPlay(sound))
+			return;
+
+		int oldest;
+		if (bank.takeOldest(sound, oldest))
+		{
+			voices[oldest].active = false;
+			voices[oldest].source = -1;
+			freeVoices.push_back(oldest);
+		}
+
+		int voice = startVoice(soundSources[sound], false, pan);
+		if (voice != -1)
+			bank.addVoice(sound, voice);
+	}
+
+	void MixerAudio::playSound(const char *sound, bool loop)
+	{
+		auto it = streamSources.find(sound);
+		if (it == streamSources.end())
+		{
+			// decoded whole on first use, there is no streaming decoder
+			std::string path = sound;
+			int source = -1;
+			PCMData data;
+			if (path.size() >= 4 && path.compare(path.size() - 4, 4, ".wav") != 0)
+			{
+				LOG_WARNING("Mixer can't decode %s, skipping", path.c_str());
+			}
+			else if (data.loadWav(path, SAMPLE_RATE))
+			{
+				source = pcm.size();
+				pcm.push_back(std::move(data));
+			}
+			it = streamSources.insert(std::make_pair(path, source)).first;
+		}
+
+		if (it->second != -1)
+			startVoice(it->second, loop, 0); // music plays centred
+	}
+
+	void MixerAudio::stopAllSounds()
+	{
+		freeVoices.clear();
+		for (int i = MAX_VOICES - 1; i >= 0; i--)
+		{
+			voices[i].active = false;
+			voices[i].source = -1;
+			freeVoices.push_back(i);
+		}
+		bank.clear([](int) { });
+	}
+
+	void MixerAudio::update()
+	{
+		pendingFrames += framesPerTick;
+		while (pendingFrames >= BLOCK_FRAMES)
+		{
+			mixBlock();
+			pendingFrames -= BLOCK_FRAMES;
+		}
+
+		// hand back voices that played out, a voice's source is cleared
+		// once it's back on the free list
+		bank.reap([this](int voice) { return !voices[voice].active; });
+		for (int i = 0; i < MAX_VOICES; i++)
+		{
+			if (!voices[i].active && voices[i].source != -1)
+			{
+				voices[i].source = -1;
+				freeVoices.push_back(i);
+			}
+		}
+		bank.nextFrame();
+	}
+
+	void MixerAudio::mixBlock()
+	{
+		memset(block, 0, sizeof(block));
+		for (auto& v : voices)
+		{
+			if (v.active)
+				mixVoice(v);
+		}
+		sink->write(block, BLOCK_FRAMES);
+	}
+
+	void MixerAudio::mixVoice(Voice& voice)
+	{
+		const PCMData& data = pcm[voice.source];
+		int mixed = 0;
+		while (mixed < BLOCK_FRAMES)
+		{
+			int count = std::min(BLOCK_FRAMES - mixed, data.frames - voice.position);
+			if (count <= 0)
+			{
+				if (!voice.loop || data.frames == 0)
+				{
+					voice.active = false;
+					return;
+				}
+				voice.position = 0;
+				continue;
+			}
+
+			const float *source = &data.samples[voice.position * data.channels];
+			if (data.channels == 1)
+				mixMono(source, block + mixed * 2, count, voice.gainLeft, voice.gainRight);
+			else
+				mixStereo(source, block + mixed * 2, count, voice.gainLeft, voice.gainRight);
+
+			voice.position += count;
+			mixed += count;
+		}
+	}
+
+	void MixerAudio::panGains(float gain, float pan, float& left, float& right)
+	{
+		// equal power, scaled so the centre is at full gain
+		const float quarterPi = 0.785398163f;
+		float angle = (pan + 1) * quarterPi;
+		left = gain * std::cos(angle) * 1.41421356f;
+		right = gain * std::sin(angle) * 1.41421356f;
+	}
+
+	void MixerAudio::mixMono(const float *source, float *out, int frames, float left, float right)
+	{
+		int i = 0;
+#ifdef MIXER_SSE
+		__m128 gains = _mm_setr_ps(left, right, left, right);
+		for (; i + 4 <= frames; i += 4)
+		{
+			__m128 s = _mm_loadu_ps(source + i);
+			__m128 lo = _mm_unpacklo_ps(s, s); // s0 s0 s1 s1
+			__m128 hi = _mm_unpackhi_ps(s, s); // s2 s2 s3 s3
+			float *o = out + i * 2;
+			_mm_storeu_ps(o, _mm_add_ps(_mm_loadu_ps(o), _mm_mul_ps(lo, gains)));
+			_mm_storeu_ps(o + 4, _mm_add_ps(_mm_loadu_ps(o + 4), _mm_mul_ps(hi, gains)));
+		}
+#endif
+		for (; i < frames; i++)
+		{
+			out[i * 2] += source[i] * left;
+			out[i * 2 + 1] += source[i] * right;
+		}
+	}
+
+	void MixerAudio::mixStereo(const float *source, float *out, int frames, float left, float right)
+	{
+		int i = 0;
+#ifdef MIXER_SSE
+		__m128 gains = _mm_setr_ps(left, right, left, right);
+		for (; i + 2 <= frames; i += 2)
+		{
+			float *o = out + i * 2;
+			__m128 s = _mm_loadu_ps(source + i * 2);
+			_mm_storeu_ps(o, _mm_add_ps(_mm_loadu_ps(o), _mm_mul_ps(s, gains)));
+		}
+#endif
+		for (; i < frames; i++)
+		{
+			out[i * 2] += source[i * 2] * left;
+			out[i * 2 + 1] += source[i * 2 + 1] * right;
+		}
+	}
+}
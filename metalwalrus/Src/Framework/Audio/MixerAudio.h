@@ -0,0 +1,78 @@
+#ifndef MIXERAUDIO_H
+#define MIXERAUDIO_H
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Audio.h"
+#include "AudioSink.h"
+#include "PCMData.h"
+#include "SoundBank.h"
+
+namespace metalwalrus
+{
+	// software mixer, decodes sounds to float PCM at load and mixes every
+	// voice in fixed size blocks. each update mixes one tick's worth of
+	// audio into the sink, so it should run on the audio thread behind
+	// AsyncAudio. only .wav is decoded, other formats are skipped
+	class MixerAudio : public Audio
+	{
+	public:
+		static const int SAMPLE_RATE = 44100;
+		static const int BLOCK_FRAMES = 256;
+		static const int MAX_VOICES = 128;
+	private:
+		struct Voice
+		{
+			int source; // index into pcm
+			int position; // next frame to mix
+			float gainLeft, gainRight;
+			bool loop;
+			bool active;
+		};
+
+		AudioSink *sink; // owned
+		double framesPerTick;
+		double pendingFrames; // mixed once there's a whole block
+
+		std::vector<PCMData> pcm;
+		std::vector<int> soundSources; // pcm index for each SoundID, -1 if it failed to load
+		std::map<std::string, int> streamSources; // pcm index by path, -1 if it failed
+
+		Voice voices[MAX_VOICES];
+		std::vector<int> freeVoices;
+		SoundBank<int> bank;
+		int droppedVoices; // plays lost because every voice was busy
+
+		float block[BLOCK_FRAMES * 2];
+
+		int startVoice(int source, bool loop, float pan);
+		void mixVoice(Voice& voice);
+	protected:
+		virtual void preload(SoundID sound, const std::string& path, int maxVoices) override;
+	public:
+		MixerAudio(AudioSink *sink, int ticksPerSecond = 60);
+		~MixerAudio();
+
+		virtual void playSound(SoundID sound, float pan = 0) override;
+		virtual void playSound(const char* sound, bool loop = false) override;
+		virtual void stopAllSounds() override;
+		virtual void update() override;
+
+		// mixes one block into the sink
+		void mixBlock();
+
+		int get_activeVoices() const { return MAX_VOICES - freeVoices.size(); }
+		int get_droppedVoices() const { return droppedVoices; }
+
+		// gain of 1 and pan from -1 (left) to 1 (right), equal power
+		static void panGains(float gain, float pan, float& left, float& right);
+		// out += source * gains, out is interleaved stereo
+		static void mixMono(const float *source, float *out, int frames, float left, float right);
+		static void mixStereo(const float *source, float *out, int frames, float left, float right);
+	};
+}
+
+#endif // MIXERAUDIO_H
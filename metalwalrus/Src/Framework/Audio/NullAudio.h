@@ -3,15 +3,37 @@
 #pragma once
 
 #include "Audio.h"
+#include "SoundBank.h"
 
 namespace metalwalrus
 {
+	// plays nothing, but keeps the same voice books as a real backend so
+	// limits and stealing can be checked without an audio device. voices
+	// never finish on their own
 	class NullAudio : public Audio
 	{
+		SoundBank<int> bank;
+		int nextVoice = 0;
+	protected:
+		virtual void preload(SoundID sound, const std::string& path, int maxVoices) override
+		{
+			bank.add(sound, maxVoices);
+		}
 	public:
-		virtual void playSound(const char* sound, bool loop = false) { }
-		virtual void stopAllSounds() { }
+		virtual void playSound(SoundID sound, float pan = 0) override
+		{
+			if (!bank.has(sound) || !bank.beginPlay(sound))
+				return;
+			int oldest;
+			bank.takeOldest(sound, oldest);
+			bank.addVoice(sound, nextVoice++);
+		}
+		virtual void playSound(const char* sound, bool loop = false) override { }
+		virtual void stopAllSounds() override { bank.clear([](int) { }); }
+		virtual void update() override { bank.nextFrame(); }
+
+		const SoundBank<int>& get_bank() const { return bank; }
 	};
 }
 
-#endif // NULLAUDIO_H
\ No newline at end of file
+#endif // NULLAUDIO_H
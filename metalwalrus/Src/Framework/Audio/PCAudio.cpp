@@ -1,12 +1,55 @@
 #include "PCAudio.h"
 
+#include "../Util/Debug.h"
+
 namespace metalwalrus
 {
 	PCAudio::~PCAudio()
 	{
+		bank.clear([](irrklang::ISound *voice) { voice->drop(); });
 		engine->drop();
 	}
 
+	void PCAudio::preload(SoundID sound, const std::string& path, int maxVoices)
+	{
+		irrklang::ISoundSource *source = engine->addSoundSourceFromFile(path.c_str(),
+			irrklang::ESM_NO_STREAMING, true);
+		if (source == nullptr)
+			source = engine->getSoundSource(path.c_str(), false); // already added
+		if (source == nullptr)
+			LOG_ERROR("Could not load sound %s", path.c_str());
+
+		if (sound >= sources.size())
+			sources.resize(sound + 1, nullptr);
+		sources[sound] = source;
+		bank.add(sound, maxVoices);
+	}
+
+	void PCAudio::playSound(SoundID sound, float pan)
+	{
+		if (sound < 0 || sound >= sources.size() || sources[sound] == nullptr)
+			return;
+		if (!bank.beginPlay(sound))
+			return;
+
+		irrklang::ISound *oldest;
+		if (bank.takeOldest(sound, oldest))
+		{
+			oldest->stop();
+			oldest->drop();
+		}
+
+		// tracked so the voice can be stolen, it's dropped once finished
+		// started paused so the pan is set before the first sample plays
+		irrklang::ISound *voice = engine->play2D(sources[sound], false, true, true);
+		if (voice != nullptr)
+		{
+			voice->setPan(pan);
+			voice->setIsPaused(false);
+			bank.addVoice(sound, voice);
+		}
+	}
+
 	void PCAudio::playSound(const char * sound, bool loop)
 	{
 		engine->play2D(sound, loop);
@@ -15,5 +58,17 @@ namespace metalwalrus
 	void PCAudio::stopAllSounds()
 	{
 		engine->stopAllSounds();
+		bank.clear([](irrklang::ISound *voice) { voice->drop(); });
+	}
+
+	void PCAudio::update()
+	{
+		bank.reap([](irrklang::ISound *voice) {
+			if (!voice->isFinished())
+				return false;
+			voice->drop();
+			return true;
+		});
+		bank.nextFrame();
 	}
-}
\ No newline at end of file
+}
@@ -2,22 +2,31 @@
 #define PCAUDIO_H
 #pragma once
 
+#include <vector>
+
 #include <irrKlang\irrKlang.h>
 
 #include "Audio.h"
+#include "SoundBank.h"
 
 namespace metalwalrus
 {
 	class PCAudio : public Audio
 	{
 		irrklang::ISoundEngine *engine;
+		std::vector<irrklang::ISoundSource*> sources; // indexed by SoundID
+		SoundBank<irrklang::ISound*> bank;
+	protected:
+		virtual void preload(SoundID sound, const std::string& path, int maxVoices) override;
 	public:
 		PCAudio(irrklang::ISoundEngine *engine) : engine(engine) { }
 		~PCAudio();
 
+		virtual void playSound(SoundID sound, float pan = 0) override;
 		virtual void playSound(const char* sound, bool loop = false) override;
 		virtual void stopAllSounds() override;
+		virtual void update() override;
 	};
 }
 
-#endif // PCAUDIO_H
\ No newline at end of file
+#endif // PCAUDIO_H
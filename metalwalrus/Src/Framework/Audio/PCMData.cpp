@@ -0,0 +1,107 @@
+#include "PCMData.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "../Util/Debug.h"
+
+namespace metalwalrus
+{
+	static uint32_t readLE(const uint8_t *bytes, int count)
+	{
+		uint32_t value = 0;
+		for (int i = 0; i < count; i++)
+			value |= (uint32_t)bytes[i] << (i * 8);
+		return value;
+	}
+
+	bool PCMData::loadWav(const std::string& path, int sampleRate)
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		if (file.size() < 12 || memcmp(&file[0], "RIFF", 4) != 0 || memcmp(&file[8], "WAVE", 4) != 0)
+		{
+			LOG_ERROR("Could not read wav %s", path.c_str());
+			return false;
+		}
+
+		int format = 0, fileChannels = 0, fileRate = 0, bits = 0;
+		const uint8_t *data = nullptr;
+		size_t dataSize = 0;
+		for (size_t i = 12; i + 8 <= file.size();)
+		{
+			size_t chunkSize = readLE(file.data() + i + 4, 4);
+			const uint8_t *chunk = file.data() + i + 8; // may be the end for an empty last chunk
+			if (i + 8 + chunkSize > file.size())
+				chunkSize = file.size() - i - 8; // truncated, take what's there
+
+			if (memcmp(&file[i], "fmt ", 4) == 0 && chunkSize >= 16)
+			{
+				format = readLE(chunk, 2);
+				fileChannels = readLE(chunk + 2, 2);
+				fileRate = readLE(chunk + 4, 4);
+				bits = readLE(chunk + 14, 2);
+			}
+			else if (memcmp(&file[i], "data", 4) == 0)
+			{
+				data = chunk;
+				dataSize = chunkSize;
+			}
+			i += 8 + chunkSize + (chunkSize & 1);
+		}
+
+		bool supported = (format == 1 && (bits == 8 || bits == 16))
+			|| (format == 3 && bits == 32);
+		if (data == nullptr || !supported || fileChannels < 1 || fileChannels > 2 || fileRate <= 0)
+		{
+			LOG_ERROR("Unsupported wav format in %s", path.c_str());
+			return false;
+		}
+
+		int bytesPerSample = bits / 8;
+		int fileFrames = dataSize / (bytesPerSample * fileChannels);
+		std::vector<float> decoded(fileFrames * fileChannels);
+		for (size_t i = 0; i < decoded.size(); i++)
+		{
+			const uint8_t *s = data + i * bytesPerSample;
+			if (bits == 8)
+				decoded[i] = (s[0] - 128) / 128.0f;
+			else if (bits == 16)
+				decoded[i] = (int16_t)readLE(s, 2) / 32768.0f;
+			else
+			{
+				uint32_t raw = readLE(s, 4);
+				memcpy(&decoded[i], &raw, 4);
+			}
+		}
+
+		this->channels = fileChannels;
+		if (fileRate == sampleRate)
+		{
+			this->frames = fileFrames;
+			this->samples.swap(decoded);
+			return true;
+		}
+
+		// linear resampling is plenty for short effects
+		double step = (double)fileRate / sampleRate;
+		this->frames = (int)(fileFrames / step);
+		this->samples.resize(frames * channels);
+		for (int f = 0; f < frames; f++)
+		{
+			double pos = f * step;
+			int i0 = (int)pos;
+			int i1 = i0 + 1 < fileFrames ? i0 + 1 : i0;
+			float t = (float)(pos - i0);
+			for (int c = 0; c < channels; c++)
+			{
+				float a = decoded[i0 * channels + c];
+				float b = decoded[i1 * channels + c];
+				samples[f * channels + c] = a + (b - a) * t;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,23 @@
+#ifndef PCMDATA_H
+#define PCMDATA_H
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace metalwalrus
+{
+	// a decoded sound, float samples in [-1, 1] interleaved by channel
+	struct PCMData
+	{
+		int channels = 0;
+		int frames = 0;
+		std::vector<float> samples;
+
+		// reads an 8 or 16 bit PCM or 32 bit float .wav with one or two
+		// channels, resampling it to sampleRate
+		bool loadWav(const std::string& path, int sampleRate);
+	};
+}
+
+#endif // PCMDATA_H
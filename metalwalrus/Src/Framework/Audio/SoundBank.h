@@ -0,0 +1,132 @@
+#ifndef SOUNDBANK_H
+#define SOUNDBANK_H
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "Audio.h"
+
+namespace metalwalrus
+{
+	// voice bookkeeping shared by the audio backends, Voice is whatever
+	// handle the backend uses for a playing sound. a sound only starts once
+	// per frame, and past its voice limit the oldest voice is stolen
+	template <typename Voice>
+	class SoundBank
+	{
+		struct Sound
+		{
+			unsigned lastFrame; // frame the sound last started on
+			// ring of playing voices, oldest at head. sized to the voice
+			// limit when the sound is added so playing never allocates
+			std::vector<Voice> voices;
+			int head;
+			int count;
+
+			Voice& at(int i) { return voices[(head + i) % voices.size()]; }
+		};
+
+		std::vector<Sound> sounds;
+		unsigned frame;
+		int voiceCount;
+		int deduped; // plays dropped because the sound already started this frame
+		int stolen;
+	public:
+		SoundBank() : frame(1), voiceCount(0), deduped(0), stolen(0) { }
+
+		void add(SoundID sound, int maxVoices)
+		{
+			if (sound >= (int)sounds.size())
+				sounds.resize(sound + 1);
+			Sound& s = sounds[sound];
+			s.voices.assign(maxVoices < 1 ? 1 : maxVoices, Voice());
+			s.head = 0;
+			s.count = 0;
+			s.lastFrame = 0;
+		}
+
+		bool has(SoundID sound) const { return sound >= 0 && sound < (int)sounds.size(); }
+
+		// false if the sound has already started this frame, a second voice
+		// in the same frame would only make it louder
+		bool beginPlay(SoundID sound)
+		{
+			Sound& s = sounds[sound];
+			if (s.lastFrame == frame)
+			{
+				deduped++;
+				return false;
+			}
+			s.lastFrame = frame;
+			return true;
+		}
+
+		// if the sound is at its voice limit, removes its oldest voice so
+		// the caller can stop it
+		bool takeOldest(SoundID sound, Voice& oldest)
+		{
+			Sound& s = sounds[sound];
+			if (s.count < (int)s.voices.size())
+				return false;
+			oldest = s.voices[s.head];
+			s.head = (s.head + 1) % s.voices.size();
+			s.count--;
+			voiceCount--;
+			stolen++;
+			return true;
+		}
+
+		// the sound must have room, call takeOldest first
+		void addVoice(SoundID sound, Voice voice)
+		{
+			Sound& s = sounds[sound];
+			assert(s.count < (int)s.voices.size());
+			s.at(s.count) = voice;
+			s.count++;
+			voiceCount++;
+		}
+
+		// finished(voice) returns true if the voice is done, and releases
+		// it. it's called once per voice, and the rest keep their order
+		template <typename Finished>
+		void reap(Finished finished)
+		{
+			for (auto& s : sounds)
+			{
+				int kept = 0;
+				for (int i = 0; i < s.count; i++)
+				{
+					Voice v = s.at(i);
+					if (!finished(v))
+						s.at(kept++) = v;
+				}
+				voiceCount -= s.count - kept;
+				s.count = kept;
+			}
+		}
+
+		template <typename Release>
+		void clear(Release release)
+		{
+			for (auto& s : sounds)
+			{
+				for (int i = 0; i < s.count; i++)
+					release(s.at(i));
+				s.head = 0;
+				s.count = 0;
+			}
+			voiceCount = 0;
+		}
+
+		void nextFrame() { frame++; }
+
+		int get_soundCount() const { return (int)sounds.size(); }
+		int get_voiceCount() const { return voiceCount; }
+		int get_voiceCount(SoundID sound) const { return sounds[sound].count; }
+		int get_deduped() const { return deduped; }
+		int get_stolen() const { return stolen; }
+	};
+}
+
+#endif // SOUNDBANK_H
@@ -0,0 +1,62 @@
+#include "WavSink.h"
+
+#include "../Util/Debug.h"
+
+namespace metalwalrus
+{
+	static void putLE(std::ofstream& out, uint32_t value, int bytes)
+	{
+		for (int i = 0; i < bytes; i++)
+			out.put((char)((value >> (i * 8)) & 0xFF));
+	}
+
+	WavSink::WavSink(const std::string& path, int sampleRate)
+		: out(path, std::ios::binary), dataBytes(0)
+	{
+		if (!out.good())
+			LOG_ERROR("Could not open %s for audio output", path.c_str());
+		writeHeader(sampleRate);
+	}
+
+	WavSink::~WavSink()
+	{
+		// patch the RIFF and data chunk sizes now the length is known
+		out.seekp(4);
+		putLE(out, 36 + dataBytes, 4);
+		out.seekp(40);
+		putLE(out, dataBytes, 4);
+	}
+
+	void WavSink::writeHeader(int sampleRate)
+	{
+		const int channels = 2, bits = 16;
+		out.write("RIFF", 4);
+		putLE(out, 36, 4);
+		out.write("WAVEfmt ", 8);
+		putLE(out, 16, 4);
+		putLE(out, 1, 2); // PCM
+		putLE(out, channels, 2);
+		putLE(out, sampleRate, 4);
+		putLE(out, sampleRate * channels * bits / 8, 4);
+		putLE(out, channels * bits / 8, 2);
+		putLE(out, bits, 2);
+		out.write("data", 4);
+		putLE(out, 0, 4);
+	}
+
+	void WavSink::write(const float *frames, int count)
+	{
+		if (count <= 0)
+			return;
+		buffer.resize(count * 2);
+		for (int i = 0; i < count * 2; i++)
+		{
+			float s = frames[i];
+			s = s > 1.0f ? 1.0f : (s < -1.0f ? -1.0f : s);
+			buffer[i] = (int16_t)(s * 32767.0f);
+		}
+		// the format is little endian, as is every platform we build for
+		out.write((const char*)&buffer[0], buffer.size() * sizeof(int16_t));
+		dataBytes += buffer.size() * sizeof(int16_t);
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef WAVSINK_H
+#define WAVSINK_H
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AudioSink.h"
+
+namespace metalwalrus
+{
+	// writes the mix to a 16 bit stereo .wav, the header sizes are filled
+	// in when the sink is destroyed
+	class WavSink : public AudioSink
+	{
+		std::ofstream out;
+		uint32_t dataBytes;
+		std::vector<int16_t> buffer;
+
+		void writeHeader(int sampleRate);
+	public:
+		WavSink(const std::string& path, int sampleRate);
+		~WavSink();
+
+		virtual void write(const float *frames, int count) override;
+	};
+}
+
+#endif // WAVSINK_H
@@ -0,0 +1,74 @@
+#ifndef COMPONENTARRAY_H
+#define COMPONENTARRAY_H
+#pragma once
+
+#include <vector>
+
+namespace metalwalrus
+{
+	// sparse set of components keyed by entity index, the components
+	// themselves are packed contiguously so systems can walk them linearly
+	template <typename T>
+	class ComponentArray
+	{
+		std::vector<int> sparse; // entity index -> dense index, -1 if absent
+		std::vector<int> entities; // dense index -> entity index
+		std::vector<T> components;
+	public:
+		bool has(int entity) const
+		{
+			return entity < (int)sparse.size() && sparse[entity] != -1;
+		}
+
+		T& add(int entity, const T& component)
+		{
+			if (entity >= (int)sparse.size())
+				sparse.resize(entity + 1, -1);
+
+			if (sparse[entity] != -1)
+			{
+				components[sparse[entity]] = component;
+				return components[sparse[entity]];
+			}
+
+			sparse[entity] = components.size();
+			entities.push_back(entity);
+			components.push_back(component);
+			return components.back();
+		}
+
+		void remove(int entity)
+		{
+			if (!has(entity))
+				return;
+
+			// swap the last component into the hole
+			int index = sparse[entity];
+			int last = components.size() - 1;
+			components[index] = components[last];
+			entities[index] = entities[last];
+			sparse[entities[index]] = index;
+
+			components.pop_back();
+			entities.pop_back();
+			sparse[entity] = -1;
+		}
+
+		T& get(int entity) { return components[sparse[entity]]; }
+		const T& get(int entity) const { return components[sparse[entity]]; }
+
+		// dense access for system passes
+		int size() const { return components.size(); }
+		T& at(int index) { return components[index]; }
+		int entityAt(int index) const { return entities[index]; }
+
+		void clear()
+		{
+			sparse.clear();
+			entities.clear();
+			components.clear();
+		}
+	};
+}
+
+#endif // COMPONENTARRAY_H
@@ -0,0 +1,38 @@
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+#pragma once
+
+#include "../Math/Vector2.h"
+#include "../Graphics/TextureRegion.h"
+
+namespace metalwalrus
+{
+	struct Transform
+	{
+		Vector2 position;
+	};
+
+	struct Velocity
+	{
+		Vector2 velocity;
+	};
+
+	// box relative to the transform, world bounds are refreshed by
+	// Systems::updateColliders so the collision pass doesn't touch transforms
+	struct Collider
+	{
+		Vector2 offset;
+		float width, height;
+		unsigned layer; // bit mask, colliders pair if their layers overlap
+
+		float minX, minY, maxX, maxY;
+	};
+
+	struct Sprite
+	{
+		TextureRegion *region;
+		bool flipX;
+	};
+}
+
+#endif // COMPONENTS_H
@@ -0,0 +1,58 @@
+#include "EntityWorld.h"
+
+namespace metalwalrus
+{
+	EntityID EntityWorld::create()
+	{
+		int index;
+		if (freeIndices.size() > 0)
+		{
+			index = freeIndices.back();
+			freeIndices.pop_back();
+		}
+		else
+		{
+			index = generations.size();
+			generations.push_back(0);
+		}
+		aliveCount++;
+		return EntityID(index, generations[index]);
+	}
+
+	void EntityWorld::destroy(EntityID entity)
+	{
+		if (!is_alive(entity))
+			return;
+
+		transforms.remove(entity.index);
+		velocities.remove(entity.index);
+		colliders.remove(entity.index);
+		sprites.remove(entity.index);
+
+		generations[entity.index]++;
+		freeIndices.push_back(entity.index);
+		aliveCount--;
+	}
+
+	void EntityWorld::clear()
+	{
+		transforms.clear();
+		velocities.clear();
+		colliders.clear();
+		sprites.clear();
+
+		freeIndices.clear();
+		for (int i = generations.size() - 1; i >= 0; i--)
+		{
+			generations[i]++;
+			freeIndices.push_back(i);
+		}
+		aliveCount = 0;
+	}
+
+	bool EntityWorld::is_alive(EntityID entity) const
+	{
+		return entity.index >= 0 && entity.index < generations.size()
+			&& generations[entity.index] == entity.generation;
+	}
+}
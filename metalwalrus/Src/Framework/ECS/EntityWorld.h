@@ -0,0 +1,38 @@
+#ifndef ENTITYWORLD_H
+#define ENTITYWORLD_H
+#pragma once
+
+#include <vector>
+
+#include "../Game/ObjectHandle.h"
+#include "ComponentArray.h"
+#include "Components.h"
+
+namespace metalwalrus
+{
+	// entities share the generational handle scheme used for scene objects
+	typedef ObjectHandle EntityID;
+
+	class EntityWorld
+	{
+		std::vector<int> generations;
+		std::vector<int> freeIndices;
+		int aliveCount;
+	public:
+		ComponentArray<Transform> transforms;
+		ComponentArray<Velocity> velocities;
+		ComponentArray<Collider> colliders;
+		ComponentArray<Sprite> sprites;
+
+		EntityWorld() : aliveCount(0) { }
+
+		EntityID create();
+		void destroy(EntityID entity);
+		void clear();
+
+		bool is_alive(EntityID entity) const;
+		int get_aliveCount() const { return aliveCount; }
+	};
+}
+
+#endif // ENTITYWORLD_H
@@ -0,0 +1,72 @@
+#include "ObjectBridge.h"
+
+#include "../Game/GameObject.h"
+#include "../Game/SolidObject.h"
+
+namespace metalwalrus
+{
+	EntityID ObjectBridge::track(GameObject *obj, unsigned layer)
+	{
+		EntityID e = world.create();
+		Transform t = { obj->get_position() };
+		world.transforms.add(e.index, t);
+
+		SolidObject *solid = dynamic_cast<SolidObject*>(obj);
+		if (solid != nullptr)
+		{
+			AABB bb = solid->get_boundingBox();
+			Collider c = { bb.get_min() - obj->get_position(), bb.get_width(), bb.get_height(), layer,
+				bb.get_left(), bb.get_bottom(), bb.get_right(), bb.get_top() };
+			world.colliders.add(e.index, c);
+		}
+
+		Link l = { obj->get_ID(), e };
+		links.push_back(l);
+		return e;
+	}
+
+	void ObjectBridge::untrack(GameObject *obj)
+	{
+		for (int i = 0; i < links.size(); i++)
+		{
+			if (links[i].object != obj->get_ID())
+				continue;
+			world.destroy(links[i].entity);
+			links[i] = links.back();
+			links.pop_back();
+			return;
+		}
+	}
+
+	void ObjectBridge::pushToWorld()
+	{
+		for (int i = 0; i < links.size(); i++)
+		{
+			GameObject *obj = scene.getWithID(links[i].object);
+			if (obj == nullptr || obj->is_destroyed())
+			{
+				// object was destroyed by the scene
+				world.destroy(links[i].entity);
+				links[i] = links.back();
+				links.pop_back();
+				i--;
+				continue;
+			}
+			world.transforms.get(links[i].entity.index).position = obj->get_position();
+		}
+	}
+
+	void ObjectBridge::pullFromWorld()
+	{
+		for (int i = 0; i < links.size(); i++)
+		{
+			GameObject *obj = scene.getWithID(links[i].object);
+			if (obj == nullptr)
+				continue;
+			const Vector2& pos = world.transforms.get(links[i].entity.index).position;
+			Vector2 current = obj->get_position();
+			if (pos.x != current.x || pos.y != current.y)
+				obj->moveTo(pos);
+		}
+	}
+}
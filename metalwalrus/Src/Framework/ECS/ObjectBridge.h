@@ -0,0 +1,43 @@
+#ifndef OBJECTBRIDGE_H
+#define OBJECTBRIDGE_H
+#pragma once
+
+#include <vector>
+
+#include "EntityWorld.h"
+#include "../Scene/IScene.h"
+
+namespace metalwalrus
+{
+	class GameObject; // forward declaration
+
+	// mirrors scene objects into an EntityWorld so systems can run over them
+	// while the object still owns its update/draw logic, objects destroyed
+	// by the scene are dropped on the next sync
+	class ObjectBridge
+	{
+		struct Link
+		{
+			ObjectHandle object;
+			EntityID entity;
+		};
+
+		EntityWorld& world;
+		IScene& scene;
+		std::vector<Link> links;
+	public:
+		ObjectBridge(EntityWorld& world, IScene& scene)
+			: world(world), scene(scene) { }
+
+		EntityID track(GameObject *obj, unsigned layer = 1);
+		void untrack(GameObject *obj);
+		int get_linkCount() const { return links.size(); }
+
+		// copy object positions into transforms, call before running systems
+		void pushToWorld();
+		// move objects to their transforms, call after running systems
+		void pullFromWorld();
+	};
+}
+
+#endif // OBJECTBRIDGE_H
@@ -0,0 +1,90 @@
+#include "Systems.h"
+
+#include <algorithm>
+
+namespace metalwalrus
+{
+	std::vector<Systems::SweepEntry> Systems::sweepList;
+
+	void Systems::integrate(EntityWorld& world, double delta)
+	{
+		ComponentArray<Velocity>& velocities = world.velocities;
+		ComponentArray<Transform>& transforms = world.transforms;
+		for (int i = 0; i < velocities.size(); i++)
+		{
+			int e = velocities.entityAt(i);
+			if (!transforms.has(e))
+				continue;
+			transforms.get(e).position += velocities.at(i).velocity * delta;
+		}
+	}
+
+	void Systems::updateColliders(EntityWorld& world)
+	{
+		ComponentArray<Collider>& colliders = world.colliders;
+		ComponentArray<Transform>& transforms = world.transforms;
+		for (int i = 0; i < colliders.size(); i++)
+		{
+			int e = colliders.entityAt(i);
+			if (!transforms.has(e))
+				continue;
+			Collider& c = colliders.at(i);
+			const Vector2& pos = transforms.get(e).position;
+			c.minX = pos.x + c.offset.x;
+			c.minY = pos.y + c.offset.y;
+			c.maxX = c.minX + c.width;
+			c.maxY = c.minY + c.height;
+		}
+	}
+
+	void Systems::collide(EntityWorld& world, std::vector<EntityPair>& pairs)
+	{
+		pairs.clear();
+
+		ComponentArray<Collider>& colliders = world.colliders;
+		sweepList.resize(colliders.size());
+		for (int i = 0; i < colliders.size(); i++)
+		{
+			const Collider& c = colliders.at(i);
+			SweepEntry s = { c.minX, c.maxX, c.minY, c.maxY, c.layer, colliders.entityAt(i) };
+			sweepList[i] = s;
+		}
+
+		std::sort(sweepList.begin(), sweepList.end(),
+			[](const SweepEntry& a, const SweepEntry& b) { return a.minX < b.minX; });
+
+		for (int i = 0; i < sweepList.size(); i++)
+		{
+			const SweepEntry& a = sweepList[i];
+			for (int j = i + 1; j < sweepList.size(); j++)
+			{
+				const SweepEntry& b = sweepList[j];
+				if (b.minX >= a.maxX)
+					break; // sorted on x, nothing further can overlap a
+				if ((a.layer & b.layer) == 0)
+					continue;
+				if (a.minY < b.maxY && b.minY < a.maxY)
+				{
+					EntityPair p = { a.entity, b.entity };
+					pairs.push_back(p);
+				}
+			}
+		}
+	}
+
+	void Systems::draw(EntityWorld& world, SpriteBatch& batch)
+	{
+		ComponentArray<Sprite>& sprites = world.sprites;
+		ComponentArray<Transform>& transforms = world.transforms;
+		for (int i = 0; i < sprites.size(); i++)
+		{
+			int e = sprites.entityAt(i);
+			if (!transforms.has(e))
+				continue;
+			Sprite& s = sprites.at(i);
+			const Vector2& pos = transforms.get(e).position;
+			s.region->set_flipX(s.flipX);
+			batch.drawreg(*s.region, pos.x, pos.y);
+		}
+	}
+}
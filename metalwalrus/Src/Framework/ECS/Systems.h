@@ -0,0 +1,44 @@
+#ifndef SYSTEMS_H
+#define SYSTEMS_H
+#pragma once
+
+#include <vector>
+
+#include "EntityWorld.h"
+#include "../Graphics/SpriteBatch.h"
+
+namespace metalwalrus
+{
+	struct EntityPair
+	{
+		int a;
+		int b;
+	};
+
+	class Systems
+	{
+		Systems(); // static class
+
+		struct SweepEntry
+		{
+			float minX, maxX, minY, maxY;
+			unsigned layer;
+			int entity;
+		};
+		static std::vector<SweepEntry> sweepList;
+	public:
+		// position += velocity * delta for every entity with both
+		static void integrate(EntityWorld& world, double delta);
+
+		// refresh world bounds of every collider from its transform
+		static void updateColliders(EntityWorld& world);
+
+		// sweep and prune over collider bounds, each overlapping pair is
+		// emitted once as entity indices
+		static void collide(EntityWorld& world, std::vector<EntityPair>& pairs);
+
+		static void draw(EntityWorld& world, SpriteBatch& batch);
+	};
+}
+
+#endif // SYSTEMS_H
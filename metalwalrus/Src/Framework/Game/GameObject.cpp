@@ -1,32 +1,26 @@
 #include "GameObject.h"
 
+#include "../Util/FramePacer.h"
+
 namespace metalwalrus
 {
-	int GameObject::numGameObjects;
-	
-	void GameObject::generateID()
-	{
-		this->id = numGameObjects;
-		numGameObjects++;
-	}
-
-	GameObject::GameObject(Vector2 position, float width, float height, std::string tag)
+	GameObject::GameObject(Vector2 position, float width, float height, TagID tag)
 	{
 		this->position = position;
+		this->lastPosition = position;
 		this->width = width;
 		this->height = height;
 		this->tag = tag;
-		this->generateID();
 	}
 
 	GameObject::GameObject(const GameObject & other)
 	{
 		this->position = other.position;
+		this->lastPosition = other.lastPosition;
 		this->width = other.width;
 		this->height = other.height;
 		this->parentScene = other.parentScene;
 		this->tag = other.tag;
-		this->generateID();
 	}
 
 	GameObject & GameObject::operator=(const GameObject & other)
@@ -34,11 +28,11 @@ namespace metalwalrus
 		if (this != &other)
 		{
 			this->position = other.position;
+			this->lastPosition = other.lastPosition;
 			this->width = other.width;
 			this->height = other.height;
 			this->parentScene = other.parentScene;
 			this->tag = other.tag;
-			this->generateID();
 		}
 		return *this;
 	}
@@ -53,6 +47,13 @@ namespace metalwalrus
 		this->position = v;
 	}
 
+	Vector2 GameObject::get_drawPosition() const
+	{
+		if (!FramePacer::is_interpolating())
+			return position;
+		return lastPosition + (position - lastPosition) * (float)FramePacer::get_alpha();
+	}
+
 	Vector2 GameObject::get_center()
 	{
 		return Vector2(position.x + (width / 2), position.y + (height / 2));
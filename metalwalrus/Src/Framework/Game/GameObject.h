@@ -5,39 +5,54 @@
 #include "../Math/Vector2.h"
 #include "../Graphics/SpriteBatch.h"
 #include "../Scene/IScene.h"
+#include "Tag.h"
+#include "ObjectHandle.h"
 
 namespace metalwalrus
 {
+	class IObjectPool; // forward declaration
+
 	class GameObject
 	{
 	private:
-		static int numGameObjects;
-		void generateID();
+		int tagIndex = -1; // position in the parent scene's tag bucket
+		bool destroyed = false; // queued for deletion at the end of the tick
+		IObjectPool *pool = nullptr; // owning pool, nullptr if heap allocated
+
+		friend class IScene;
 	protected:
 		Vector2 position;
+		Vector2 lastPosition; // position at the start of the tick, for interpolated drawing
 		float width, height;
-		int id;
-		std::string tag;
+		ObjectHandle id; // assigned by the scene on registration
+		TagID tag;
 		IScene *parentScene;
 	public:
-		GameObject(Vector2 position, float width, float height, std::string tag = "");
+		GameObject(Vector2 position, float width, float height, TagID tag = Tag::NONE);
 		GameObject(const GameObject& other);
-		virtual ~GameObject()
-		{
-			numGameObjects--;
-		}
+		virtual ~GameObject() { }
 
 		GameObject& operator=(const GameObject& other);
 
 		virtual void start() { };
+		// first half of the tick, run on every object in parallel. may read
+		// anything but must only write the object's own state, so no moving,
+		// spawning, destroying, damage or sounds until update
+		virtual void prepare(double delta) { };
 		virtual void update(double delta) { };
 		virtual void draw(SpriteBatch& batch) { };
 		virtual void drawDebug() { };
 
 		inline virtual Vector2 get_position() final { return position; }
-		inline virtual int get_ID() final { return id; }
+		inline void savePosition() { lastPosition = position; }
+		// where to draw this frame, between the last two ticks if the
+		// frame pacer is interpolating
+		Vector2 get_drawPosition() const;
+		inline virtual ObjectHandle get_ID() final { return id; }
 		inline void set_parentScene(IScene* scene) { parentScene = scene; }
-		inline virtual std::string get_tag() final { return tag; }
+		inline virtual TagID get_tag() final { return tag; }
+		inline bool is_destroyed() const { return destroyed; }
+		inline void set_pool(IObjectPool *pool) { this->pool = pool; }
 
 		virtual void moveBy(Vector2 v);
 		virtual void moveTo(Vector2 v);
@@ -0,0 +1,27 @@
+#ifndef OBJECTHANDLE_H
+#define OBJECTHANDLE_H
+#pragma once
+
+namespace metalwalrus
+{
+	// generational handle to an object in a scene, the generation is bumped
+	// whenever a slot is freed so stale handles stop resolving
+	struct ObjectHandle
+	{
+		int index;
+		int generation;
+
+		ObjectHandle() : index(-1), generation(0) { }
+		ObjectHandle(int index, int generation) : index(index), generation(generation) { }
+
+		bool is_valid() const { return index >= 0; }
+
+		bool operator==(const ObjectHandle& other) const
+		{
+			return index == other.index && generation == other.generation;
+		}
+		bool operator!=(const ObjectHandle& other) const { return !(*this == other); }
+	};
+}
+
+#endif // OBJECTHANDLE_H
@@ -0,0 +1,110 @@
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+#pragma once
+
+#include <cassert>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "GameObject.h"
+
+namespace metalwalrus
+{
+	// type-erased pool interface, lets IScene hand destroyed objects back
+	// and lets the debug overlay list every pool
+	class IObjectPool
+	{
+		std::string name;
+
+		static std::vector<IObjectPool*>& pools()
+		{
+			static std::vector<IObjectPool*> allPools;
+			return allPools;
+		}
+	protected:
+		int capacity;
+		int inUse;
+		int highWater;
+		int overflows; // creations that fell back to the heap because the pool was full
+
+		IObjectPool(const std::string& name, int capacity)
+			: name(name), capacity(capacity), inUse(0), highWater(0), overflows(0)
+		{
+			pools().push_back(this);
+		}
+	public:
+		virtual ~IObjectPool()
+		{
+			std::vector<IObjectPool*>& p = pools();
+			p.erase(std::remove(p.begin(), p.end(), this), p.end());
+		}
+
+		virtual void release(GameObject *obj) = 0;
+
+		const std::string& get_name() const { return name; }
+		int get_capacity() const { return capacity; }
+		int get_inUse() const { return inUse; }
+		int get_highWater() const { return highWater; }
+		int get_overflows() const { return overflows; }
+
+		static const std::vector<IObjectPool*>& get_pools() { return pools(); }
+	};
+
+	// fixed capacity pool with a free list, objects are constructed in place
+	// and released by the scene when they are destroyed
+	template <typename T>
+	class ObjectPool : public IObjectPool
+	{
+		typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+		std::vector<Storage> storage;
+		std::vector<int> freeList;
+
+		T *at(int index) { return reinterpret_cast<T*>(&storage[index]); }
+	public:
+		ObjectPool(const std::string& name, int capacity)
+			: IObjectPool(name, capacity), storage(capacity)
+		{
+			freeList.reserve(capacity);
+			for (int i = capacity - 1; i >= 0; i--)
+				freeList.push_back(i);
+		}
+
+		template <typename... Args>
+		T *create(Args&&... args)
+		{
+			if (freeList.size() == 0)
+			{
+				// pool is full, fall back to the heap rather than drop the object
+				overflows++;
+				return new T(std::forward<Args>(args)...);
+			}
+
+			int index = freeList.back();
+			freeList.pop_back();
+			T *obj = new (at(index)) T(std::forward<Args>(args)...);
+			obj->set_pool(this);
+
+			inUse++;
+			if (inUse > highWater)
+				highWater = inUse;
+			return obj;
+		}
+
+		void release(GameObject *obj) override
+		{
+			T *t = static_cast<T*>(obj);
+			// index in storage units, T pointers into separate storage elements can't be subtracted
+			int index = reinterpret_cast<Storage*>(t) - storage.data();
+			assert(index >= 0 && index < capacity && "object was not allocated from this pool");
+			t->~T();
+			freeList.push_back(index);
+			inUse--;
+		}
+	};
+}
+
+#endif // OBJECTPOOL_H
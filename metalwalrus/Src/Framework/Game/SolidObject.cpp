@@ -9,7 +9,7 @@ namespace metalwalrus
 	}
 
 	SolidObject::SolidObject(Vector2 position, float width, float height,
-		Vector2 offset, std::string tag)
+		Vector2 offset, TagID tag)
 		: GameObject(position, width, height, tag)
 	{
 		this->boundingBoxOffset = offset;
@@ -23,6 +23,8 @@ namespace metalwalrus
 	{
 		this->boundingBox = other.boundingBox;
 		this->boundingBoxOffset = other.boundingBoxOffset;
+		this->collisionLayer = other.collisionLayer;
+		this->collisionMask = other.collisionMask;
 	}
 
 	SolidObject & SolidObject::operator=(const SolidObject & other)
@@ -32,6 +34,8 @@ namespace metalwalrus
 		{
 			this->boundingBox = other.boundingBox;
 			this->boundingBoxOffset = other.boundingBoxOffset;
+			this->collisionLayer = other.collisionLayer;
+			this->collisionMask = other.collisionMask;
 		}
 		return *this;
 	}
@@ -40,6 +44,8 @@ namespace metalwalrus
 	{
 		GameObject::moveTo(v);
 		recomputeBoundingBox();
+		if (proxy != -1)
+			parentScene->get_broadPhase().update(this);
 	}
 
 	void SolidObject::drawDebug()
@@ -63,5 +69,7 @@ namespace metalwalrus
 	{
 		GameObject::moveBy(v);
 		recomputeBoundingBox();
+		if (proxy != -1)
+			parentScene->get_broadPhase().update(this);
 	}
 }
\ No newline at end of file
@@ -10,13 +10,18 @@ namespace metalwalrus
 {
 	class SolidObject : public GameObject
 	{
+		int proxy = -1; // broadphase proxy, -1 if not in a broadphase
+
+		friend class BroadPhase;
 	protected:	
 		AABB boundingBox;
 		Vector2 boundingBoxOffset;
+		unsigned collisionLayer = 0; // objects on no layer stay out of the broadphase
+		unsigned collisionMask = 0;
 
 		void recomputeBoundingBox();
 	public:
-		SolidObject(Vector2 position, float width, float height, Vector2 offset = Vector2(), std::string tag = "");
+		SolidObject(Vector2 position, float width, float height, Vector2 offset = Vector2(), TagID tag = Tag::NONE);
 		SolidObject(const SolidObject& other);
 
 		SolidObject& operator=(const SolidObject& other);
@@ -30,6 +35,15 @@ namespace metalwalrus
 		virtual void moveTo(Vector2 v) override;
 
 		inline AABB get_boundingBox() const { return boundingBox; }
+		inline unsigned get_collisionLayer() const { return collisionLayer; }
+		inline unsigned get_collisionMask() const { return collisionMask; }
+
+		// set before the object is registered with a scene
+		inline void set_collisionLayer(unsigned layer, unsigned mask = 0)
+		{
+			collisionLayer = layer;
+			collisionMask = mask;
+		}
 	};
 }
 
@@ -0,0 +1,33 @@
+#include "Tag.h"
+
+namespace metalwalrus
+{
+	std::vector<std::string>& Tag::names()
+	{
+		// function-local so tags can be interned during static initialization
+		static std::vector<std::string> tagNames(1, "");
+		return tagNames;
+	}
+
+	TagID Tag::intern(const std::string& name)
+	{
+		std::vector<std::string>& tagNames = names();
+		for (int i = 0; i < tagNames.size(); i++)
+		{
+			if (tagNames[i] == name)
+				return i;
+		}
+		tagNames.push_back(name);
+		return tagNames.size() - 1;
+	}
+
+	const std::string& Tag::get_name(TagID tag)
+	{
+		return names()[tag];
+	}
+
+	int Tag::get_count()
+	{
+		return names().size();
+	}
+}
@@ -0,0 +1,27 @@
+#ifndef TAG_H
+#define TAG_H
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace metalwalrus
+{
+	// interned object tag, index into the tag name table
+	typedef int TagID;
+
+	class Tag
+	{
+		Tag(); // static class
+
+		static std::vector<std::string>& names();
+	public:
+		static const TagID NONE = 0;
+
+		static TagID intern(const std::string& name);
+		static const std::string& get_name(TagID tag);
+		static int get_count();
+	};
+}
+
+#endif // TAG_H
@@ -36,12 +36,11 @@ namespace metalwalrus
 		return *this;
 	}
 
-	void FontSheet::drawText(SpriteBatch & batch, std::string text, int x, int y)
+	void FontSheet::drawText(SpriteBatch & batch, const char *text, int x, int y)
 	{
-		int numChars = text.length();
 		int xPos = x;
 		int yPos = y;
-		for (int i = 0; i < numChars; i++)
+		for (int i = 0; text[i] != '\0'; i++)
 		{
 			if (text[i] == '\n')
 			{
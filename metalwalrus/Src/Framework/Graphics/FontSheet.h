@@ -23,7 +23,11 @@ namespace metalwalrus
 
 		FontSheet& operator=(const FontSheet& other);
 
-		void drawText(SpriteBatch& batch, std::string text, int x, int y);
+		void drawText(SpriteBatch& batch, const char *text, int x, int y);
+		void drawText(SpriteBatch& batch, const std::string& text, int x, int y)
+		{
+			drawText(batch, text.c_str(), x, y);
+		}
 	};
 }
 
@@ -35,7 +35,7 @@ namespace metalwalrus
 
 		GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
 		if (status != GL_FRAMEBUFFER_COMPLETE)
-			Debug::log("FrameBuffer not loaded!", Debug::LogType::ERR);
+			LOG_ERROR("FrameBuffer not loaded!");
 
 		glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	}
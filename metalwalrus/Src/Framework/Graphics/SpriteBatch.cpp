@@ -12,6 +12,7 @@
 
 #include "../Util/Debug.h"
 #include "../Util/MathUtil.h"
+#include "../Settings.h"
 
 namespace metalwalrus
 {
@@ -68,11 +69,18 @@ namespace metalwalrus
 	{
 		if (index == 0 || lastTexture == nullptr) return;
 		
-		glEnable(GL_BLEND);
-		glEnable(GL_DEPTH_TEST);
-		
 		renderCalls++;
 		totalRenderCalls++;
+
+		// no device, the vertices are built and thrown away
+		if (Settings::HEADLESS)
+		{
+			index = 0;
+			return;
+		}
+		
+		glEnable(GL_BLEND);
+		glEnable(GL_DEPTH_TEST);
 		
 		this->batchMesh->updateContents();
 		
@@ -83,7 +91,9 @@ namespace metalwalrus
 		batchMesh->bind();
 		
 		glLoadIdentity();
-		glLoadMatrixf(transformMat.glMatrix().data());
+		float glMat[16];
+		transformMat.glMatrix(glMat);
+		glLoadMatrixf(glMat);
 		glColor3f(currentColor.get_r(), currentColor.get_b(), currentColor.get_b());
 
 		batchMesh->draw(spritesInBatch);
@@ -105,13 +115,15 @@ namespace metalwalrus
 	
 	void SpriteBatch::begin()
 	{
-		glPushMatrix();
-		
 		// TODO: custom exceptions
 		if (drawing) 
 			throw std::runtime_error("A previous batch has not yet ended!");
 		
-		glDepthMask(false);
+		if (!Settings::HEADLESS)
+		{
+			glPushMatrix();
+			glDepthMask(false);
+		}
 
 		renderCalls = 0;
 		
@@ -129,11 +141,14 @@ namespace metalwalrus
 		
 		this->lastTexture = nullptr;
 		
-		glDepthMask(true);
-		glDisable(GL_DEPTH_TEST);
-		glDisable(GL_BLEND);
-		glPopMatrix();
-		glColor3f(1, 1, 1);
+		if (!Settings::HEADLESS)
+		{
+			glDepthMask(true);
+			glDisable(GL_DEPTH_TEST);
+			glDisable(GL_BLEND);
+			glPopMatrix();
+			glColor3f(1, 1, 1);
+		}
 		
 		drawing = false;
 	}
@@ -33,6 +33,7 @@ namespace metalwalrus
 		inline unsigned get_spriteWidth() const { return spriteWidth; }
 		inline unsigned get_spriteHeight() const { return spriteHeight; }
 		inline unsigned get_numSprites() const { return numSprites; }
+		inline Texture2D *get_texture() const { return texRegion.get_texture(); }
 
 		TextureRegion *get_sprite(int index);
 
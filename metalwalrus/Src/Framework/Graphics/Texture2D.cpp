@@ -2,6 +2,7 @@
 #include "../Util/IOUtil.h"
 #include "../Util/Debug.h"
 #include "../Util/GLError.h"
+#include "../Settings.h"
 
 namespace metalwalrus
 {
@@ -56,7 +57,8 @@ namespace metalwalrus
 	Texture2D::~Texture2D()
 	{
 		delete data;
-		glDeleteTextures(1, &this->glHandle);
+		if (glHandle != 0)
+			glDeleteTextures(1, &this->glHandle);
 	}
 
 	void Texture2D::load()
@@ -66,6 +68,9 @@ namespace metalwalrus
 			throw std::runtime_error("Cannot load texture, already loaded!");
 			return;
 		}
+
+		if (Settings::HEADLESS)
+			return;
 		
 		glGenTextures(1, &glHandle);
 		bind();
@@ -167,7 +172,7 @@ namespace metalwalrus
 	{
 		if (this->glHandle == 0)
 		{
-			Debug::log("Could not bind texture, has not been generated!", Debug::LogType::ERR);
+			LOG_ERROR("Could not bind texture, has not been generated!");
 			return;
 		}
 		glBindTexture(GL_TEXTURE_2D, this->glHandle);
@@ -1,7 +1,13 @@
 #include "TileMap.h"
 
+#include <cmath>
+#include <algorithm>
+
 namespace metalwalrus
 {
+	const float TileMap::oneWayTolerance = 1;
+	const unsigned TileMap::collisionCellTiles = 8;
+
 	void TileMap::initializeEmpty()
 	{
 		this->addLayer("0");
@@ -25,30 +31,13 @@ namespace metalwalrus
 		this->initializeEmpty();
 	}
 
-	TileMap::TileMap(const TileMap& other)
-	{
-		this->layers = other.layers;
-		this->tileSheets = other.tileSheets;
-		this->width = other.width;
-		this->height = other.height;
-		this->camera = other.camera;
-		this->initialTileIDs = other.initialTileIDs;
-		this->cumulativeTileID = other.cumulativeTileID;
-	}
-
-	TileMap & TileMap::operator=(const TileMap& other)
+	TileMap::~TileMap()
 	{
-		if (this != &other)
+		for (SpriteSheet *sheet : tileSheets)
 		{
-			this->layers = other.layers;
-			this->tileSheets = other.tileSheets;
-			this->width = other.width;
-			this->height = other.height;
-			this->camera = other.camera;
-			this->initialTileIDs = other.initialTileIDs;
-			this->cumulativeTileID = other.cumulativeTileID;
+			delete sheet->get_texture();
+			delete sheet;
 		}
-		return *this;
 	}
 
 	Tile & TileMap::get(unsigned x, unsigned y, std::string name)
@@ -82,7 +71,7 @@ namespace metalwalrus
 			(cameraPos.x) / tileWidth,
 			(cameraPos.y) / tileHeight);
 
-		for (auto layer : layers)
+		for (auto& layer : layers)
 		{
 			if (layer.properties.hasProperty("objectLayer") && layer.properties.getProperty<bool>("objectLayer")) 
 				continue;
@@ -97,7 +86,7 @@ namespace metalwalrus
 					if (tileXIndex >= width || tileYIndex >= height
 						|| tileXIndex < 0 || tileYIndex < 0) continue;
 
-					Tile t = layer.get(tileXIndex, tileYIndex);
+					Tile& t = layer.get(tileXIndex, tileYIndex);
 
 					if (t.get_tileID() == 0) continue;
 
@@ -157,15 +146,15 @@ namespace metalwalrus
 		if (topTile >= this->get_height())
 			return false;
 
+		TileLayer *layer = get_layer(0u);
 		for (int i = leftTile; i <= rightTile; i++)
 		{
 			for (int j = bottomTile; j <= topTile; j++)
 			{
-				Tile t = this->get(i, j, 0);
-				if (t.is_solid())
+				if (layer->is_solid(i, j) || layer->is_oneWay(i, j))
 				{
-					tbb = t.get_boundingBox();
-					tile = t;
+					tile = layer->get(i, j);
+					tbb = tile.get_boundingBox();
 					return true;
 				}
 			}
@@ -173,6 +162,204 @@ namespace metalwalrus
 		return false;
 	}
 
+	void TileMap::sweepX(AABB box, float dx, TileSweep& result)
+	{
+		sweep(box, dx, false, result);
+	}
+
+	void TileMap::sweepY(AABB box, float dy, TileSweep& result)
+	{
+		sweep(box, dy, true, result);
+	}
+
+	void TileMap::sweep(const AABB& box, float move, bool vertical, TileSweep& result)
+	{
+		const float epsilon = 0.001f;
+
+		result.hit = false;
+		result.oneWay = false;
+		result.distance = move;
+		result.time = 1;
+		result.normal = Vector2::ZERO;
+		result.contacts.clear();
+
+		if (move == 0)
+			return;
+
+		// everything the box passes through, one-way tops may be up to a pixel inside it
+		Vector2 min = box.get_min();
+		Vector2 max = box.get_max();
+		if (vertical)
+		{
+			if (move > 0) max.y += move;
+			else min.y += move;
+		}
+		else
+		{
+			if (move > 0) max.x += move;
+			else min.x += move;
+		}
+		result.candidates.clear();
+		collision.query(AABB(min, max), result.candidates);
+
+		// work in (along, across) coordinates so both axes share one loop
+		float lo = vertical ? box.get_bottom() : box.get_left();
+		float hi = vertical ? box.get_top() : box.get_right();
+		float acrossLo = vertical ? box.get_left() : box.get_bottom();
+		float acrossHi = vertical ? box.get_right() : box.get_top();
+		bool oneWayFace = vertical && move < 0;
+
+		float nearest = move;
+		for (int i : result.candidates)
+		{
+			const StaticGeometry::Rect& r = collision.get_rect(i);
+			if (r.oneWay && !oneWayFace)
+				continue;
+
+			float rLo = vertical ? r.box.get_bottom() : r.box.get_left();
+			float rHi = vertical ? r.box.get_top() : r.box.get_right();
+			float rAcrossLo = vertical ? r.box.get_left() : r.box.get_bottom();
+			float rAcrossHi = vertical ? r.box.get_right() : r.box.get_top();
+
+			// rects that only touch the box across the sweep don't count
+			if (rAcrossHi <= acrossLo + epsilon || rAcrossLo >= acrossHi - epsilon)
+				continue;
+
+			float distance;
+			if (move > 0)
+			{
+				if (rLo < hi - epsilon) continue; // behind the leading edge
+				distance = rLo - hi;
+				if (distance > nearest) continue;
+			}
+			else
+			{
+				if (rHi > lo + (r.oneWay ? oneWayTolerance : epsilon)) continue;
+				distance = rHi - lo;
+				if (distance < nearest) continue;
+			}
+
+			// a nearer face replaces everything found so far
+			if (!result.hit || std::abs(distance - nearest) > epsilon)
+			{
+				result.contacts.clear();
+				result.oneWay = true;
+			}
+			result.hit = true;
+			result.oneWay = result.oneWay && r.oneWay;
+			result.contacts.push_back(i);
+			nearest = distance;
+		}
+
+		if (result.hit)
+		{
+			int step = move > 0 ? 1 : -1;
+			result.distance = nearest;
+			result.time = std::max(0.0f, std::min(1.0f, nearest / move));
+			result.normal = vertical ? Vector2(0, (float)-step) : Vector2((float)-step, 0);
+		}
+	}
+
+	void TileMap::buildCollision()
+	{
+		collision.clear();
+
+		TileLayer *layer = get_layer(0u);
+		mergeMask(*layer, false);
+		mergeMask(*layer, true);
+
+		float tileWidth = tileSheets[0]->get_spriteWidth();
+		float tileHeight = tileSheets[0]->get_spriteHeight();
+		collision.bake((width + collisionCellTiles - 1) / collisionCellTiles,
+			(height + collisionCellTiles - 1) / collisionCellTiles,
+			tileWidth * collisionCellTiles, tileHeight * collisionCellTiles);
+	}
+
+	void TileMap::mergeMask(TileLayer& layer, bool oneWay)
+	{
+		float tileWidth = tileSheets[0]->get_spriteWidth();
+		float tileHeight = tileSheets[0]->get_spriteHeight();
+		unsigned words = layer.get_wordsPerRow();
+
+		vector<uint64_t> remaining(words * height);
+		for (unsigned y = 0; y < height; y++)
+		{
+			for (unsigned w = 0; w < words; w++)
+			{
+				remaining[y * words + w] = oneWay
+					? layer.get_oneWayWord(y, w) : layer.get_solidWord(y, w);
+			}
+		}
+
+		for (unsigned y = 0; y < height; y++)
+		{
+			uint64_t *row = &remaining[y * words];
+			for (unsigned x = 0; x < width; x++)
+			{
+				if (((row[x / 64] >> (x % 64)) & 1) == 0)
+					continue;
+
+				// widest run along the row
+				unsigned right = x;
+				while (right + 1 < width && ((row[(right + 1) / 64] >> ((right + 1) % 64)) & 1))
+					right++;
+
+				// then grow upwards while the next row has the whole run. one-way
+				// tiles stay one row high, their tops are the only faces that block
+				unsigned top = y;
+				while (!oneWay && top + 1 < height)
+				{
+					uint64_t *next = &remaining[(top + 1) * words];
+					bool full = true;
+					for (unsigned w = x / 64; w <= right / 64 && full; w++)
+					{
+						uint64_t span = TileLayer::spanBits(w, x, right);
+						full = (next[w] & span) == span;
+					}
+					if (!full)
+						break;
+					top++;
+				}
+
+				for (unsigned ry = y; ry <= top; ry++)
+				{
+					for (unsigned w = x / 64; w <= right / 64; w++)
+						remaining[ry * words + w] &= ~TileLayer::spanBits(w, x, right);
+				}
+
+				collision.add(AABB(Vector2(x * tileWidth, y * tileHeight),
+					Vector2((right + 1) * tileWidth, (top + 1) * tileHeight)), oneWay);
+				x = right;
+			}
+		}
+	}
+
+	void TileMap::drawDebug()
+	{
+		glLineWidth(1);
+		glBegin(GL_LINES);
+		for (int i = 0; i < collision.get_rectCount(); i++)
+		{
+			const StaticGeometry::Rect& r = collision.get_rect(i);
+			if (r.oneWay)
+				glColor3f(0, 1, 1);
+			else
+				glColor3f(0, 1, 0);
+
+			Vector2 min = r.box.get_min();
+			Vector2 max = r.box.get_max();
+			glVertex2f(min.x, min.y);
+			glVertex2f(max.x, min.y);
+			glVertex2f(max.x, min.y);
+			glVertex2f(max.x, max.y);
+			glVertex2f(max.x, max.y);
+			glVertex2f(min.x, max.y);
+			glVertex2f(min.x, max.y);
+			glVertex2f(min.x, min.y);
+		}
+		glEnd();
+		glColor3f(1, 1, 1);
+	}
 
 	// -------------- TILE METHODS -----------------------
 
@@ -252,6 +439,7 @@ namespace metalwalrus
 
 		this->name = name;
 		this->tileMap = map;
+		this->buildMasks();
 	}
 
 	TileLayer::TileLayer(const TileLayer & other)
@@ -261,6 +449,9 @@ namespace metalwalrus
 		this->name = other.name;
 		this->tileMap = other.tileMap;
 		this->properties = other.properties;
+		this->wordsPerRow = other.wordsPerRow;
+		this->solidMask = other.solidMask;
+		this->oneWayMask = other.oneWayMask;
 	}
 
 	TileLayer & TileLayer::operator=(const TileLayer & other)
@@ -271,6 +462,9 @@ namespace metalwalrus
 			this->name = other.name;
 			this->tileMap = other.tileMap;
 			this->properties = other.properties;
+			this->wordsPerRow = other.wordsPerRow;
+			this->solidMask = other.solidMask;
+			this->oneWayMask = other.oneWayMask;
 		}
 		return *this;
 	}
@@ -279,4 +473,41 @@ namespace metalwalrus
 	{
 		return this->layer[y][x];
 	}
+
+	void TileLayer::buildMasks()
+	{
+		unsigned height = layer.size();
+		unsigned width = height > 0 ? layer[0].size() : 0;
+		this->wordsPerRow = (width + 63) / 64;
+		this->solidMask.assign(wordsPerRow * height, 0);
+		this->oneWayMask.assign(wordsPerRow * height, 0);
+
+		for (unsigned y = 0; y < height; y++)
+		{
+			for (unsigned x = 0; x < width; x++)
+			{
+				Tile& t = layer[y][x];
+				if (!t.is_solid())
+					continue;
+
+				uint64_t bit = (uint64_t)1 << (x % 64);
+				if (t.is_oneWay())
+					oneWayMask[y * wordsPerRow + x / 64] |= bit;
+				else
+					solidMask[y * wordsPerRow + x / 64] |= bit;
+			}
+		}
+	}
+
+	uint64_t TileLayer::spanBits(unsigned word, unsigned x0, unsigned x1)
+	{
+		unsigned first = word * 64;
+		unsigned last = first + 63;
+		uint64_t bits = ~(uint64_t)0;
+		if (x0 > first)
+			bits &= ~(uint64_t)0 << (x0 - first);
+		if (x1 < last)
+			bits &= ~(uint64_t)0 >> (last - x1);
+		return bits;
+	}
 }
\ No newline at end of file
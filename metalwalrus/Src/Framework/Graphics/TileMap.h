@@ -4,12 +4,14 @@
 
 #include <vector>
 #include <map>
+#include <cstdint>
 using namespace std;
 
 #include "../Graphics/Camera.h"
 #include "../Graphics/SpriteSheet.h"
 #include "../Math/Vector2.h"
 #include "../Physics/AABB.h"
+#include "../Physics/StaticGeometry.h"
 
 namespace metalwalrus
 {
@@ -45,6 +47,18 @@ namespace metalwalrus
 		inline AABB get_boundingBox() const { return boundingBox; }
 	};
 
+	// result of sweeping a box along one axis through the collision layer
+	struct TileSweep
+	{
+		bool hit = false;
+		bool oneWay = false; // every contact was a one-way platform
+		float distance = 0; // how far the box can move, signed like the requested move
+		float time = 0; // distance as a fraction of the requested move
+		Vector2 normal; // of the blocking face, zero if nothing was hit
+		vector<int> contacts; // every collision rect touched at the time of impact
+		vector<int> candidates; // scratch, kept per sweep so objects can sweep in parallel
+	};
+
 	typedef vector<Tile> tilerow;
 	typedef vector<tilerow> tilelayer;
 
@@ -53,6 +67,12 @@ namespace metalwalrus
 		tilelayer layer;
 		std::string name;
 		TileMap *tileMap;
+
+		// one bit per tile, 64 tiles to a word, rows padded to whole words.
+		// solid bits don't include one-way tiles, they have their own mask
+		unsigned wordsPerRow;
+		vector<uint64_t> solidMask;
+		vector<uint64_t> oneWayMask;
 	public:
 		PropertyContainer properties;
 
@@ -64,6 +84,19 @@ namespace metalwalrus
 		Tile& get(unsigned x, unsigned y);
 		std::string get_name() const { return name; }
 		void set_name(std::string name) { this->name = name; }
+
+		// rebuild the collision masks from the tiles, has to be called again
+		// if tiles are changed after the level is loaded
+		void buildMasks();
+
+		inline unsigned get_wordsPerRow() const { return wordsPerRow; }
+		inline uint64_t get_solidWord(unsigned y, unsigned word) const { return solidMask[y * wordsPerRow + word]; }
+		inline uint64_t get_oneWayWord(unsigned y, unsigned word) const { return oneWayMask[y * wordsPerRow + word]; }
+		inline bool is_solid(unsigned x, unsigned y) const { return (get_solidWord(y, x / 64) >> (x % 64)) & 1; }
+		inline bool is_oneWay(unsigned x, unsigned y) const { return (get_oneWayWord(y, x / 64) >> (x % 64)) & 1; }
+
+		// bits of the given word that fall within tiles x0..x1 (inclusive)
+		static uint64_t spanBits(unsigned word, unsigned x0, unsigned x1);
 	};
 
 	class TileMap
@@ -79,14 +112,23 @@ namespace metalwalrus
 		Camera* camera;
 		PropertyContainer properties;
 
+		StaticGeometry collision; // merged solid tiles of layer 0
+
+		static const float oneWayTolerance;
+		static const unsigned collisionCellTiles;
+
 		void initializeEmpty();
+		void mergeMask(TileLayer& layer, bool oneWay);
+		void sweep(const AABB& box, float move, bool vertical, TileSweep& result);
 	public:
 		TileMap(unsigned width, unsigned height, Camera *cam);
 		TileMap(SpriteSheet *tileSheet, unsigned width, unsigned height, 
 			Camera *cam);
-		TileMap(const TileMap& other);
+		// owns its tile sheets and their textures, so it can't be copied
+		TileMap(const TileMap& other) = delete;
+		~TileMap();
 		
-		TileMap& operator=(const TileMap& other);
+		TileMap& operator=(const TileMap& other) = delete;
 
 		inline vector<SpriteSheet*>& get_sheets() { return tileSheets; }
 		inline vector<TileLayer>& get_layers() { return layers; }
@@ -98,6 +140,7 @@ namespace metalwalrus
 		Tile& get(unsigned x, unsigned y, std::string layer);
 		Tile& get(unsigned x, unsigned y, unsigned layer);
 		void addLayer(std::string name);
+		// the map takes the sheet and deletes it, and its texture, with itself
 		void addTileSheet(SpriteSheet *sheet);
 		void draw(SpriteBatch& batch, unsigned squaresDown, unsigned squaresAcross);
 		TileLayer* get_layer(std::string name);
@@ -107,6 +150,18 @@ namespace metalwalrus
 		PropertyContainer& get_properties() { return properties; }
 
 		bool boundingBoxCollides(AABB boundingBox, AABB& tbb, Tile& t);
+
+		// merge the solid and one-way tiles of layer 0 into as few rectangles
+		// as possible, needs the layer's masks to be built first
+		void buildCollision();
+		inline const StaticGeometry& get_collision() const { return collision; }
+		void drawDebug();
+
+		// move a box along one axis against the collision rects, stopping at
+		// the first blocking face. one-way platforms only block
+		// downward movement that starts on (or within a pixel of) their top
+		void sweepX(AABB box, float dx, TileSweep& result);
+		void sweepY(AABB box, float dy, TileSweep& result);
 	};
 
 	
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include "../Util/GLError.h"
+#include "../Settings.h"
 
 namespace metalwalrus
 {
@@ -23,8 +24,10 @@ namespace metalwalrus
 
 	VertexData::~VertexData()
 	{
-		glDeleteBuffers(1, &vertHandle);
-		glDeleteBuffers(1, &indHandle);
+		if (vertHandle != 0)
+			glDeleteBuffers(1, &vertHandle);
+		if (indHandle != 0)
+			glDeleteBuffers(1, &indHandle);
 		//delete vertices;
 		//delete indices;
 	}
@@ -67,6 +70,9 @@ namespace metalwalrus
 			throw std::runtime_error("Vertex buffer already loaded!");
 			return;
 		}
+
+		if (Settings::HEADLESS)
+			return;
 		
 		// Create VBO
 		glGenBuffers(1, &vertHandle);
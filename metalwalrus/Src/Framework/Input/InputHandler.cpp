@@ -1,11 +1,15 @@
 #include "InputHandler.h"
 
+#include "InputRecording.h"
+
 namespace metalwalrus
 {
-	std::map<std::string, InputButton> InputHandler::inputs;
+	std::map<std::string, InputID> InputHandler::inputIDs;
+	std::vector<InputButton> InputHandler::buttons;
 	std::vector<ButtonState> InputHandler::states;
-	bool InputHandler::keys[348] = {};
-	
+	bool InputHandler::keys[GLFW_KEY_LAST + 1] = {};
+	std::vector<bool> InputHandler::down;
+
 	void InputHandler::updateButtonState(ButtonState* state, bool button)
 	{
 		if (button)
@@ -25,33 +29,59 @@ namespace metalwalrus
 				*state = ButtonState::IDLE;
 		}
 	}
-	
-	void InputHandler::addInput(std::string name, int code)
+
+	InputID InputHandler::addInput(const std::string& name, int code)
 	{
-		InputButton b = { code, states.size() };
+		auto existing = inputIDs.find(name);
+		if (existing != inputIDs.end())
+		{
+			buttons[existing->second].code = code;
+			return existing->second;
+		}
+
+		InputID id = buttons.size();
+		InputButton b = { code };
+		buttons.push_back(b);
 		states.push_back(ButtonState::IDLE);
-		inputs[name] = b;
+		inputIDs[name] = id;
+		return id;
 	}
 
-	bool InputHandler::checkButton(std::string name, ButtonState state)
+	InputID InputHandler::get_inputID(const std::string& name)
 	{
-		return states[inputs[name].stateIndex] == state;
+		auto it = inputIDs.find(name);
+		if (it == inputIDs.end())
+			return INVALID_INPUT;
+		return it->second;
+	}
+
+	bool InputHandler::checkButton(const std::string& name, ButtonState state)
+	{
+		InputID id = get_inputID(name);
+		if (id == INVALID_INPUT)
+			return false;
+		return checkButton(id, state);
 	}
 
 	void InputHandler::handleInput()
 	{
-		for (auto it = inputs.begin();
-			it != inputs.end(); it++)
-		{
-			InputButton button = it->second;
-			ButtonState *state = &states[button.stateIndex];
+		down.resize(buttons.size());
+		for (size_t i = 0; i < buttons.size(); i++)
+			down[i] = keys[buttons[i].code];
+
+		// a replay replaces the keyboard here, a recording keeps a copy
+		InputRecording::sampleButtons(down);
 
-			updateButtonState(state, keys[button.code]);
+		for (size_t i = 0; i < buttons.size(); i++)
+		{
+			updateButtonState(&states[i], down[i]);
 		}
 	}
 
 	void InputHandler::updateKeys(int key, int action)
 	{
+		if (key < 0 || key > GLFW_KEY_LAST)
+			return; // GLFW_KEY_UNKNOWN
 		keys[key] = action;
 	}
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <GLFW/glfw3.h>
 
 #include <map>
+#include <string>
 #include <vector>
 
 namespace metalwalrus
@@ -17,24 +18,40 @@ namespace metalwalrus
 		IDLE = 3
 	};
 
+	// handle to a registered input, index into the flat button arrays
+	typedef int InputID;
+
 	struct InputButton
 	{
 		int code;
-		int stateIndex;
 	};
-	
+
 	class InputHandler
 	{
-		static std::map<std::string, InputButton> inputs;
+		static std::map<std::string, InputID> inputIDs; // only used for lookup by name
+		static std::vector<InputButton> buttons;
 		static std::vector<ButtonState> states;
-		static bool keys[348];
+		static bool keys[GLFW_KEY_LAST + 1];
+		static std::vector<bool> down; // per button, scratch for handleInput
 
 		InputHandler(); // you can't instantiate InputHandler
 
 		static void updateButtonState(ButtonState *state, bool button);
 	public:
-		static void addInput(std::string name, int code);
-		static bool checkButton(std::string name, ButtonState state);
+		static const InputID INVALID_INPUT = -1;
+
+		static InputID addInput(const std::string& name, int code);
+		static InputID get_inputID(const std::string& name);
+		static int get_inputCount() { return buttons.size(); }
+
+		inline static bool checkButton(InputID input, ButtonState state)
+		{
+			if (input < 0 || input >= (int)states.size())
+				return false; // INVALID_INPUT or an unbound action
+			return states[input] == state;
+		}
+		static bool checkButton(const std::string& name, ButtonState state);
+
 		static void handleInput();
 		static void updateKeys(int key, int action);
 	};
@@ -0,0 +1,229 @@
+#include "InputRecording.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "../Util/Debug.h"
+
+namespace metalwalrus
+{
+	InputRecording::Mode InputRecording::mode = InputRecording::Mode::OFF;
+	std::string InputRecording::path;
+	unsigned InputRecording::seed = 0;
+	int InputRecording::startLevel = 0;
+	int InputRecording::buttonCount = 0;
+	int InputRecording::bytesPerTick = 0;
+	std::vector<uint8_t> InputRecording::ticks;
+	std::vector<uint32_t> InputRecording::hashes;
+	int InputRecording::tick = 0;
+	int InputRecording::divergedTick = -1;
+
+	static const char magic[4] = { 'M', 'W', 'I', 'R' };
+	static const uint16_t version = 1;
+
+	static void writeInt(std::ofstream& out, uint32_t value, int bytes)
+	{
+		for (int i = 0; i < bytes; i++)
+			out.put((char)((value >> (i * 8)) & 0xFF));
+	}
+
+	static uint32_t readInt(std::ifstream& in, int bytes)
+	{
+		uint32_t value = 0;
+		for (int i = 0; i < bytes; i++)
+			value |= (uint32_t)(uint8_t)in.get() << (i * 8);
+		return value;
+	}
+
+	static void writeVarint(std::ofstream& out, uint32_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.put((char)((value & 0x7F) | 0x80));
+			value >>= 7;
+		}
+		out.put((char)value);
+	}
+
+	static uint32_t readVarint(std::ifstream& in)
+	{
+		uint32_t value = 0;
+		for (int shift = 0; shift < 35 && in.good(); shift += 7)
+		{
+			uint8_t b = (uint8_t)in.get();
+			value |= (uint32_t)(b & 0x7F) << shift;
+			if ((b & 0x80) == 0)
+				break;
+		}
+		return value;
+	}
+
+	void InputRecording::startRecording(const std::string& path, int buttonCount,
+		unsigned seed, int startLevel)
+	{
+		InputRecording::mode = Mode::RECORD;
+		InputRecording::path = path;
+		InputRecording::seed = seed;
+		InputRecording::startLevel = startLevel;
+		InputRecording::buttonCount = buttonCount;
+		InputRecording::bytesPerTick = (buttonCount + 7) / 8;
+		ticks.clear();
+		hashes.clear();
+		tick = 0;
+		divergedTick = -1;
+	}
+
+	bool InputRecording::startReplay(const std::string& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		char fileMagic[4] = { 0 };
+		in.read(fileMagic, 4);
+		if (!in.good() || std::string(fileMagic, 4) != std::string(magic, 4))
+		{
+			LOG_ERROR("Could not read replay %s", path.c_str());
+			return false;
+		}
+		if (readInt(in, 2) != version)
+		{
+			LOG_ERROR("Unsupported replay version in %s", path.c_str());
+			return false;
+		}
+
+		InputRecording::path = path;
+		buttonCount = readInt(in, 2);
+		bytesPerTick = (buttonCount + 7) / 8;
+		seed = readInt(in, 4);
+		startLevel = (int32_t)readInt(in, 4);
+		int tickCount = readInt(in, 4);
+
+		// undo the run length and delta encoding
+		ticks.assign(tickCount * bytesPerTick, 0);
+		std::vector<uint8_t> current(bytesPerTick, 0);
+		int t = 0;
+		while (t < tickCount && in.good())
+		{
+			int unchanged = readVarint(in);
+			for (int i = 0; i < unchanged && t < tickCount; i++, t++)
+				std::copy(current.begin(), current.end(), ticks.begin() + t * bytesPerTick);
+			if (t == tickCount)
+				break;
+
+			for (int b = 0; b < bytesPerTick; b++)
+				current[b] ^= (uint8_t)in.get();
+			std::copy(current.begin(), current.end(), ticks.begin() + t * bytesPerTick);
+			t++;
+		}
+
+		hashes.resize(tickCount);
+		for (int i = 0; i < tickCount; i++)
+			hashes[i] = readInt(in, 4);
+
+		if (!in.good())
+		{
+			LOG_ERROR("Replay %s is truncated", path.c_str());
+			return false;
+		}
+
+		mode = Mode::REPLAY;
+		tick = 0;
+		divergedTick = -1;
+		return true;
+	}
+
+	bool InputRecording::save()
+	{
+		if (mode != Mode::RECORD)
+			return false;
+
+		std::ofstream out(path, std::ios::binary);
+		if (!out.good())
+		{
+			LOG_ERROR("Could not write replay %s", path.c_str());
+			return false;
+		}
+
+		int tickCount = hashes.size();
+		out.write(magic, 4);
+		writeInt(out, version, 2);
+		writeInt(out, buttonCount, 2);
+		writeInt(out, seed, 4);
+		writeInt(out, (uint32_t)startLevel, 4);
+		writeInt(out, tickCount, 4);
+
+		// held buttons rarely change, so store how many ticks stayed the same
+		// followed by the bits that flipped on the tick that didn't
+		std::vector<uint8_t> previous(bytesPerTick, 0);
+		uint32_t unchanged = 0;
+		for (int t = 0; t < tickCount; t++)
+		{
+			const uint8_t *bits = &ticks[t * bytesPerTick];
+			if (std::equal(previous.begin(), previous.end(), bits))
+			{
+				unchanged++;
+				continue;
+			}
+
+			writeVarint(out, unchanged);
+			for (int b = 0; b < bytesPerTick; b++)
+				out.put((char)(bits[b] ^ previous[b]));
+			previous.assign(bits, bits + bytesPerTick);
+			unchanged = 0;
+		}
+		if (unchanged > 0)
+			writeVarint(out, unchanged);
+
+		for (int t = 0; t < tickCount; t++)
+			writeInt(out, hashes[t], 4);
+
+		return out.good();
+	}
+
+	void InputRecording::stop()
+	{
+		mode = Mode::OFF;
+	}
+
+	void InputRecording::sampleButtons(std::vector<bool>& down)
+	{
+		if (mode == Mode::RECORD)
+		{
+			// the button set is fixed once recording starts
+			ticks.resize(ticks.size() + bytesPerTick, 0);
+			uint8_t *bits = &ticks[ticks.size() - bytesPerTick];
+			for (int i = 0; i < buttonCount && i < down.size(); i++)
+			{
+				if (down[i])
+					bits[i / 8] |= 1 << (i % 8);
+			}
+		}
+		else if (mode == Mode::REPLAY)
+		{
+			if (tick >= get_tickCount())
+			{
+				stop(); // out of input, hand back to the keyboard
+				return;
+			}
+
+			const uint8_t *bits = &ticks[tick * bytesPerTick];
+			for (int i = 0; i < down.size(); i++)
+				down[i] = i < buttonCount && ((bits[i / 8] >> (i % 8)) & 1);
+		}
+	}
+
+	void InputRecording::endTick(uint32_t stateHash)
+	{
+		if (mode == Mode::RECORD)
+		{
+			hashes.push_back(stateHash);
+		}
+		else if (mode == Mode::REPLAY)
+		{
+			if (divergedTick == -1 && tick < get_tickCount() && hashes[tick] != stateHash)
+			{
+				divergedTick = tick;
+				LOG_WARNING("Replay diverged on tick %d", tick);
+			}
+		}
+		tick++;
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef INPUTRECORDING_H
+#define INPUTRECORDING_H
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace metalwalrus
+{
+	// records which buttons were down on every fixed tick, along with a hash
+	// of the game state at the end of the tick, and plays them back in place
+	// of the keyboard. a replay reports the first tick whose hash differs
+	//
+	// file layout, little endian:
+	//   "MWIR", u16 version, u16 button count, u32 seed, i32 start level,
+	//   u32 tick count, then the input as (varint unchanged ticks, button
+	//   bits xor the previous tick's) records, then a u32 hash per tick
+	class InputRecording
+	{
+		enum class Mode
+		{
+			OFF,
+			RECORD,
+			REPLAY
+		};
+
+		static Mode mode;
+		static std::string path;
+		static unsigned seed;
+		static int startLevel;
+		static int buttonCount;
+		static int bytesPerTick;
+		static std::vector<uint8_t> ticks; // bytesPerTick of button bits per tick
+		static std::vector<uint32_t> hashes;
+		static int tick;
+		static int divergedTick;
+
+		InputRecording(); // static class
+	public:
+		// startLevel is whatever the caller needs to rebuild the starting
+		// scene, the seed should be the one passed to srand
+		static void startRecording(const std::string& path, int buttonCount,
+			unsigned seed, int startLevel);
+		static bool startReplay(const std::string& path);
+		static bool save();
+		static void stop();
+
+		// called by InputHandler each tick with the buttons that are down,
+		// records them or overwrites them with the replay's
+		static void sampleButtons(std::vector<bool>& down);
+		// called after each tick's update with the state hash
+		static void endTick(uint32_t stateHash);
+
+		static bool is_recording() { return mode == Mode::RECORD; }
+		static bool is_replaying() { return mode == Mode::REPLAY; }
+		static bool is_active() { return mode != Mode::OFF; }
+		static unsigned get_seed() { return seed; }
+		static int get_startLevel() { return startLevel; }
+		static int get_tickCount() { return hashes.size(); }
+		static int get_tick() { return tick; }
+		static int get_divergedTick() { return divergedTick; } // -1 if the replay matched so far
+	};
+}
+
+#endif // INPUTRECORDING_H
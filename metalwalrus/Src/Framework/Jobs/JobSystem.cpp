@@ -0,0 +1,183 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+#include "../Util/AllocationTracker.h"
+
+namespace metalwalrus
+{
+	std::vector<std::thread> JobSystem::threads;
+	std::vector<JobSystem::Queue*> JobSystem::queues;
+	std::atomic<bool> JobSystem::running(false);
+	std::atomic<int> JobSystem::queuedJobs(0);
+	std::mutex JobSystem::sleepLock;
+	std::condition_variable JobSystem::wake;
+	thread_local int JobSystem::queueIndex = 0;
+
+	void JobSystem::Queue::push_back(const Job& job)
+	{
+		unsigned capacity = jobs.size();
+		if (count == capacity)
+		{
+			// unwrap into a buffer twice the size
+			std::vector<Job> grown(capacity * 2);
+			for (unsigned i = 0; i < count; i++)
+				grown[i] = jobs[(first + i) & (capacity - 1)];
+			jobs.swap(grown);
+			first = 0;
+			capacity *= 2;
+		}
+		jobs[(first + count) & (capacity - 1)] = job;
+		count++;
+	}
+
+	JobSystem::Job JobSystem::Queue::pop_back()
+	{
+		count--;
+		return jobs[(first + count) & (jobs.size() - 1)];
+	}
+
+	JobSystem::Job JobSystem::Queue::pop_front()
+	{
+		Job job = jobs[first];
+		first = (first + 1) & (jobs.size() - 1);
+		count--;
+		return job;
+	}
+
+	void JobSystem::start(int threadCount)
+	{
+		if (running)
+			return;
+
+		if (threadCount <= 0)
+			threadCount = std::thread::hardware_concurrency();
+		if (threadCount <= 0)
+			threadCount = 1;
+
+		running = true;
+		queueIndex = 0;
+		AllocationTracker::set_simulationThread();
+		for (int i = 0; i < threadCount; i++)
+			queues.push_back(new Queue(initialQueueCapacity));
+		for (int i = 1; i < threadCount; i++)
+			threads.push_back(std::thread(workerLoop, i));
+	}
+
+	void JobSystem::stop()
+	{
+		{
+			std::lock_guard<std::mutex> guard(sleepLock);
+			running = false;
+		}
+		wake.notify_all();
+
+		for (auto& t : threads)
+			t.join();
+		threads.clear();
+
+		for (auto q : queues)
+			delete q;
+		queues.clear();
+	}
+
+	bool JobSystem::pop(int queue, Job& job)
+	{
+		Queue *q = queues[queue];
+		std::lock_guard<std::mutex> guard(q->lock);
+		if (q->count == 0)
+			return false;
+
+		job = q->pop_back();
+		queuedJobs--;
+		return true;
+	}
+
+	bool JobSystem::steal(int thief, Job& job)
+	{
+		int count = queues.size();
+		for (int i = 1; i < count; i++)
+		{
+			Queue *q = queues[(thief + i) % count];
+			std::lock_guard<std::mutex> guard(q->lock);
+			if (q->count == 0)
+				continue;
+
+			job = q->pop_front();
+			queuedJobs--;
+			return true;
+		}
+		return false;
+	}
+
+	void JobSystem::run(const Job& job)
+	{
+		(*job.body)(job.begin, job.end);
+		job.remaining->fetch_sub(1, std::memory_order_release);
+	}
+
+	void JobSystem::workerLoop(int index)
+	{
+		queueIndex = index;
+		AllocationTracker::set_simulationThread();
+		while (running)
+		{
+			Job job;
+			if (pop(index, job) || steal(index, job))
+			{
+				run(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(sleepLock);
+			wake.wait(lock, [] { return !running || queuedJobs > 0; });
+		}
+	}
+
+	void JobSystem::parallel_for(int count, int grain, const RangeFunc& body)
+	{
+		if (count <= 0)
+			return;
+		if (grain < 1)
+			grain = 1;
+
+		// not worth waking anyone up
+		if (threads.size() == 0 || count <= grain)
+		{
+			body(0, count);
+			return;
+		}
+
+		int chunks = (count + grain - 1) / grain;
+		std::atomic<int> remaining(chunks);
+
+		// deal chunks out to every queue so workers start without stealing
+		int queueCount = queues.size();
+		for (int q = 0; q < queueCount; q++)
+		{
+			Queue *queue = queues[(queueIndex + q) % queueCount];
+			std::lock_guard<std::mutex> guard(queue->lock);
+			for (int c = q; c < chunks; c += queueCount)
+			{
+				Job job = { &body, c * grain, std::min(count, (c + 1) * grain), &remaining };
+				queue->push_back(job);
+				queuedJobs++;
+			}
+		}
+		{
+			// a worker checks for jobs under this lock before sleeping, taking
+			// it here means it can't miss the wake up
+			std::lock_guard<std::mutex> guard(sleepLock);
+		}
+		wake.notify_all();
+
+		while (remaining.load(std::memory_order_acquire) > 0)
+		{
+			Job job;
+			if (pop(queueIndex, job) || steal(queueIndex, job))
+				run(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+namespace metalwalrus
+{
+	// fixed pool of worker threads, each with its own job queue. threads run
+	// their own queue newest first and steal the oldest jobs of the others
+	// when theirs is empty. the thread calling parallel_for helps out until
+	// its jobs are done, so nested calls can't deadlock
+	class JobSystem
+	{
+		typedef std::function<void(int, int)> RangeFunc;
+
+		struct Job
+		{
+			const RangeFunc *body;
+			int begin, end;
+			std::atomic<int> *remaining;
+		};
+
+		// ring buffer of jobs, the capacity is a power of two and only grows
+		// when a batch needs more room than any before it, so a steady tick
+		// pushes and pops without touching the heap
+		struct Queue
+		{
+			std::mutex lock;
+			std::vector<Job> jobs;
+			unsigned first; // oldest job
+			unsigned count;
+
+			Queue(unsigned capacity) : jobs(capacity), first(0), count(0) { }
+
+			void push_back(const Job& job);
+			Job pop_back();
+			Job pop_front();
+		};
+
+		static const unsigned initialQueueCapacity = 256;
+
+		static std::vector<std::thread> threads;
+		static std::vector<Queue*> queues; // queue 0 belongs to the thread that called start
+		static std::atomic<bool> running;
+		static std::atomic<int> queuedJobs;
+		static std::mutex sleepLock;
+		static std::condition_variable wake;
+		static thread_local int queueIndex;
+
+		JobSystem(); // static class
+
+		static bool pop(int queue, Job& job);
+		static bool steal(int thief, Job& job);
+		static void run(const Job& job);
+		static void workerLoop(int index);
+	public:
+		// threadCount includes the calling thread, 0 picks one per hardware
+		// thread. parallel_for should only be called from that thread or jobs
+		static void start(int threadCount = 0);
+		static void stop();
+
+		static int get_threadCount() { return threads.size() + 1; }
+
+		// calls body(begin, end) over [0, count) in chunks of at most grain
+		// items, returns once every chunk has run. chunks may run on any
+		// thread in any order, so body must only write state owned by its range
+		static void parallel_for(int count, int grain, const RangeFunc& body);
+	};
+}
+
+#endif // JOBSYSTEM_H
@@ -1,5 +1,6 @@
 #include "Matrix3.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <cmath>
 
@@ -22,7 +23,7 @@ namespace metalwalrus
 	// copy constructor
 	Matrix3::Matrix3(const Matrix3& other)
 	{
-		this->val = other.val;
+		std::copy(other.val, other.val + MATRIX_VALS, this->val);
 	}
 
 	// copy assignment operator
@@ -30,7 +31,7 @@ namespace metalwalrus
 	{
 		if (this != &other) 
 		{
-			this->val = other.val;
+			std::copy(other.val, other.val + MATRIX_VALS, this->val);
 		}
 
 		return *this;
@@ -117,7 +118,7 @@ namespace metalwalrus
 
 	void Matrix3::set(float values[MATRIX_VALS])
 	{
-		this->val.assign(values, values + MATRIX_VALS);
+		std::copy(values, values + MATRIX_VALS, this->val);
 	}
 
 	Matrix3 *Matrix3::identity()
@@ -126,7 +127,7 @@ namespace metalwalrus
 		newVals[M00] = 1;
 		newVals[M11] = 1;
 		newVals[M22] = 1;
-		val.assign(newVals, newVals+MATRIX_VALS);
+		std::copy(newVals, newVals + MATRIX_VALS, val);
 		return this;
 	}
 
@@ -249,26 +250,24 @@ namespace metalwalrus
 		return translation(v.x, v.y);
 	}
 
-	std::vector<float> Matrix3::glMatrix() const
+	void Matrix3::glMatrix(float out[16]) const
 	{
-            std::vector<float> glMat(16);
-            glMat[0] = val[M00];
-            glMat[1] = val[M10];
-            glMat[2] = 0;
-            glMat[3] = val[M20];
-            glMat[4] = val[M01];
-            glMat[5] = val[M11];
-            glMat[6] = 0;
-            glMat[7] = val[M21];
-            glMat[8] = 0;
-            glMat[9] = 0;
-            glMat[10] = 1;
-            glMat[11] = 0;
-            glMat[12] = val[M02];
-            glMat[13] = val[M12];
-            glMat[14] = 0;
-            glMat[15] = val[M22];
-            return glMat;
+            out[0] = val[M00];
+            out[1] = val[M10];
+            out[2] = 0;
+            out[3] = val[M20];
+            out[4] = val[M01];
+            out[5] = val[M11];
+            out[6] = 0;
+            out[7] = val[M21];
+            out[8] = 0;
+            out[9] = 0;
+            out[10] = 1;
+            out[11] = 0;
+            out[12] = val[M02];
+            out[13] = val[M12];
+            out[14] = 0;
+            out[15] = val[M22];
 	}
 
 	Matrix3 operator*(const float scalar, const Matrix3& other)
@@ -4,8 +4,6 @@
 
 #include "Vector2.h"
 
-#include <vector>
-
 namespace metalwalrus 
 {
     class Matrix3 
@@ -25,7 +23,7 @@ namespace metalwalrus
 
 	const static Matrix3 IDENTITY;
 
-	std::vector<float> val;
+	float val[MATRIX_VALS];
 
 	Matrix3();
 	Matrix3(float values[MATRIX_VALS]);
@@ -59,7 +57,8 @@ namespace metalwalrus
 	static Matrix3 translation(float x, float y);
 	static Matrix3 translation(Vector2 v);
 
-	std::vector<float> glMatrix() const;
+	// column major 4x4 for glLoadMatrixf
+	void glMatrix(float out[16]) const;
     };
 
 }
@@ -67,7 +67,7 @@ namespace metalwalrus
 		return *this;
 	}
 
-	bool AABB::intersects(AABB other)
+	bool AABB::intersects(const AABB& other) const
 	{
 		if (this->max.x < other.min.x) return false; // we're left of it
 		if (this->min.x > other.max.x) return false; // right of it
@@ -35,7 +35,7 @@ namespace metalwalrus
 		inline float get_width() const { return max.x - min.x; }
 		inline float get_height() const { return max.y - min.y; }
 
-		bool intersects(AABB other);
+		bool intersects(const AABB& other) const;
 		float getXDepth(AABB other);
 		float getYDepth(AABB other);
 	};
@@ -0,0 +1,125 @@
+#ifndef BAKEDGRID_H
+#define BAKEDGRID_H
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "AABB.h"
+
+namespace metalwalrus
+{
+	// uniform grid over a level, filled once from a list of static entries
+	// and then only read. every cell's entries sit together in one array so
+	// a query walks a few short runs. Bounds is a functor giving an entry's
+	// AABB, it can hold state like the array an index entry points into
+	template <typename T, typename Bounds>
+	class BakedGrid
+	{
+		int width, height;
+		float cellWidth, cellHeight;
+
+		std::vector<int> cellStart; // cell i's entries are entries[cellStart[i]..cellStart[i + 1])
+		std::vector<T> entries;
+		Bounds bounds;
+
+		void cellRange(const AABB& box, int& minX, int& minY, int& maxX, int& maxY) const
+		{
+			// clamp so entries hanging off the map still land in the edge cells
+			minX = std::max(0, std::min(width - 1, (int)std::floor(box.get_left() / cellWidth)));
+			minY = std::max(0, std::min(height - 1, (int)std::floor(box.get_bottom() / cellHeight)));
+			maxX = std::max(0, std::min(width - 1, (int)std::floor(box.get_right() / cellWidth)));
+			maxY = std::max(0, std::min(height - 1, (int)std::floor(box.get_top() / cellHeight)));
+		}
+	public:
+		BakedGrid(Bounds bounds = Bounds()) : width(0), height(0), cellWidth(1), cellHeight(1), bounds(bounds) { }
+
+		void bake(const std::vector<T>& items, int width, int height, float cellWidth, float cellHeight)
+		{
+			this->width = width;
+			this->height = height;
+			this->cellWidth = cellWidth;
+			this->cellHeight = cellHeight;
+
+			int cellCount = width * height;
+			cellStart.assign(cellCount + 1, 0);
+
+			// count entries per cell, then prefix sum into start offsets
+			for (const T& item : items)
+			{
+				int minX, minY, maxX, maxY;
+				cellRange(bounds(item), minX, minY, maxX, maxY);
+				for (int y = minY; y <= maxY; y++)
+				{
+					for (int x = minX; x <= maxX; x++)
+						cellStart[y * width + x + 1]++;
+				}
+			}
+			for (int i = 0; i < cellCount; i++)
+				cellStart[i + 1] += cellStart[i];
+
+			entries.resize(cellStart[cellCount]);
+			std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+			for (const T& item : items)
+			{
+				int minX, minY, maxX, maxY;
+				cellRange(bounds(item), minX, minY, maxX, maxY);
+				for (int y = minY; y <= maxY; y++)
+				{
+					for (int x = minX; x <= maxX; x++)
+						entries[fill[y * width + x]++] = item;
+				}
+			}
+		}
+
+		void clear()
+		{
+			cellStart.clear();
+			entries.clear();
+			width = height = 0;
+		}
+
+		// calls callback(entry) for every entry whose bounds intersect box. an
+		// entry spanning several cells is stored in each, so it can come up
+		// more than once
+		template <typename Visit>
+		void visit(const AABB& box, Visit callback) const
+		{
+			if (width == 0 || height == 0)
+				return;
+
+			int minX, minY, maxX, maxY;
+			cellRange(box, minX, minY, maxX, maxY);
+			for (int y = minY; y <= maxY; y++)
+			{
+				for (int x = minX; x <= maxX; x++)
+				{
+					int cell = y * width + x;
+					for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++)
+					{
+						if (box.intersects(bounds(entries[i])))
+							callback(entries[i]);
+					}
+				}
+			}
+		}
+
+		// appends project(entry) for every entry accept lets through whose
+		// bounds intersect box, each one only once
+		template <typename Result, typename Accept, typename Project>
+		void query(const AABB& box, std::vector<Result>& results, Accept accept, Project project) const
+		{
+			size_t firstResult = results.size();
+			visit(box, [&](const T& entry) {
+				if (!accept(entry))
+					return;
+				Result r = project(entry);
+				if (std::find(results.begin() + firstResult, results.end(), r) == results.end())
+					results.push_back(r);
+			});
+		}
+	};
+}
+
+#endif // BAKEDGRID_H
@@ -1,50 +1,155 @@
 #include "BroadPhase.h"
 
+#include <cmath>
+#include <algorithm>
+
+#include "../Game/SolidObject.h"
+
 namespace metalwalrus
 {
-	BroadPhase::BroadPhase(std::vector<IRigidbody>& bodies)
-		: bodies(bodies) { }
+	BroadPhase::BroadPhase(float cellSize)
+		: cellSize(cellSize), currentStamp(0) { }
+
+	void BroadPhase::cellRange(const AABB& box, int& minX, int& minY, int& maxX, int& maxY) const
+	{
+		minX = (int)std::floor(box.get_left() / cellSize);
+		minY = (int)std::floor(box.get_bottom() / cellSize);
+		maxX = (int)std::floor(box.get_right() / cellSize);
+		maxY = (int)std::floor(box.get_top() / cellSize);
+	}
 
-	void BroadPhase::update(double delta)
+	void BroadPhase::insertProxy(int proxy)
 	{
-		for (int i = 0; i < bodies.size(); i++)
+		Proxy& p = proxies[proxy];
+		for (int y = p.minY; y <= p.maxY; y++)
 		{
-			bodies[i].integrate(delta);
+			for (int x = p.minX; x <= p.maxX; x++)
+				cells[cellKey(x, y)].push_back(proxy);
 		}
 	}
 
-	void BroadPhase::generatePairs()
+	void BroadPhase::removeProxy(int proxy)
 	{
-		pairs.clear();
-
-		for (int i = 0; i < bodies.size(); i++)
+		Proxy& p = proxies[proxy];
+		for (int y = p.minY; y <= p.maxY; y++)
 		{
-			for (int j = 0; j < bodies.size(); j++)
+			for (int x = p.minX; x <= p.maxX; x++)
 			{
-				if (i == j) continue; // skip self check
-
-				if (bodies[i].get_boundingBox().intersects(bodies[j].get_boundingBox()))
+				std::vector<int>& cell = cells[cellKey(x, y)];
+				auto it = std::find(cell.begin(), cell.end(), proxy);
+				if (it != cell.end())
 				{
-					pairs.push_back({ &bodies[i], &bodies[j] });
+					*it = cell.back();
+					cell.pop_back();
 				}
 			}
 		}
 	}
 
-	void BroadPhase::resolveCollisions()
+	int BroadPhase::nextStamp()
+	{
+		if (queryStamps.size() < proxies.size())
+			queryStamps.resize(proxies.size(), 0);
+		return ++currentStamp;
+	}
+
+	void BroadPhase::add(SolidObject *body)
+	{
+		if (body->proxy != -1)
+			return;
+
+		int proxy;
+		if (freeProxies.size() > 0)
+		{
+			proxy = freeProxies.back();
+			freeProxies.pop_back();
+		}
+		else
+		{
+			proxy = proxies.size();
+			proxies.push_back(Proxy());
+		}
+
+		Proxy& p = proxies[proxy];
+		p.body = body;
+		p.layer = body->collisionLayer;
+		p.mask = body->collisionMask;
+		cellRange(body->get_boundingBox(), p.minX, p.minY, p.maxX, p.maxY);
+		insertProxy(proxy);
+		body->proxy = proxy;
+	}
+
+	void BroadPhase::remove(SolidObject *body)
+	{
+		if (body->proxy == -1)
+			return;
+
+		removeProxy(body->proxy);
+		proxies[body->proxy].body = nullptr;
+		freeProxies.push_back(body->proxy);
+		body->proxy = -1;
+	}
+
+	void BroadPhase::update(SolidObject *body)
+	{
+		if (body->proxy == -1)
+			return;
+
+		Proxy& p = proxies[body->proxy];
+		int minX, minY, maxX, maxY;
+		cellRange(body->get_boundingBox(), minX, minY, maxX, maxY);
+		if (minX == p.minX && minY == p.minY && maxX == p.maxX && maxY == p.maxY)
+			return; // still in the same cells
+
+		removeProxy(body->proxy);
+		p.minX = minX;
+		p.minY = minY;
+		p.maxX = maxX;
+		p.maxY = maxY;
+		insertProxy(body->proxy);
+	}
+
+	void BroadPhase::clear()
 	{
-		// resolve for X
-		for (Pair p : pairs)
+		for (auto& p : proxies)
 		{
-			float depth = p.a->get_boundingBox().getXDepth(p.b->get_boundingBox());
-			p.a->updatePosition(Vector2(-depth, 0));
+			if (p.body != nullptr)
+				p.body->proxy = -1;
 		}
+		proxies.clear();
+		freeProxies.clear();
+		// empty the cells but keep them, the level that loads next (often
+		// the same one, after a death) fills the same cells again
+		for (auto& cell : cells)
+			cell.second.clear();
+	}
 
-		// resolve for Y
-		for (Pair p : pairs)
+	void BroadPhase::query(AABB box, unsigned mask, std::vector<SolidObject*>& results)
+	{
+		int stamp = nextStamp();
+		int minX, minY, maxX, maxY;
+		cellRange(box, minX, minY, maxX, maxY);
+		for (int y = minY; y <= maxY; y++)
 		{
-			float depth = p.a->get_boundingBox().getYDepth(p.b->get_boundingBox());
-			p.a->updatePosition(Vector2(0, -depth));
+			for (int x = minX; x <= maxX; x++)
+			{
+				auto cell = cells.find(cellKey(x, y));
+				if (cell == cells.end())
+					continue;
+
+				for (int proxy : cell->second)
+				{
+					if (queryStamps[proxy] == stamp)
+						continue;
+					queryStamps[proxy] = stamp;
+
+					const Proxy& p = proxies[proxy];
+					if ((p.layer & mask) == 0)
+						continue;
+					if (box.intersects(p.body->get_boundingBox()))
+						results.push_back(p.body);
+				}
+			}
 		}
 	}
 }
\ No newline at end of file
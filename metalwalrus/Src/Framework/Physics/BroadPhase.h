@@ -3,28 +3,54 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
 
-#include "IRigidbody.h"
+#include "AABB.h"
 
 namespace metalwalrus
 {
-	struct Pair
-	{
-		IRigidbody *a;
-		IRigidbody *b;
-	};
+	class SolidObject; // forward declaration
+
 	
+	// hashed uniform grid over the live solid objects of a scene, bodies are
+	// rehashed as they move so queries always see current bounds
 	class BroadPhase
 	{
-		std::vector<Pair> pairs;
-		std::vector<IRigidbody> &bodies;
+		struct Proxy
+		{
+			SolidObject *body; // nullptr if the proxy is free
+			unsigned layer; // layers this body is on
+			unsigned mask; // layers this body generates pairs with
+			int minX, minY, maxX, maxY; // covered cell range
+		};
+
+		float cellSize;
+		std::vector<Proxy> proxies;
+		std::vector<int> freeProxies;
+		std::unordered_map<long long, std::vector<int>> cells;
+
+		std::vector<int> queryStamps; // per proxy, dedupes bodies spanning several cells
+		int currentStamp;
+
+		static long long cellKey(int x, int y)
+		{
+			return (long long)(((unsigned long long)(unsigned)x << 32) | (unsigned)y);
+		}
+		void cellRange(const AABB& box, int& minX, int& minY, int& maxX, int& maxY) const;
+		void insertProxy(int proxy);
+		void removeProxy(int proxy);
+		int nextStamp();
 	public:
-		BroadPhase(std::vector<IRigidbody> &bodies);
+		BroadPhase(float cellSize = 32);
 		
-		void update(double delta);
-		void generatePairs();
-		void resolveCollisions();
+		void add(SolidObject *body);
+		void remove(SolidObject *body);
+		void update(SolidObject *body); // call when the body's bounding box changes
+		void clear();
+
+		// appends every body on a layer in mask whose bounding box intersects box
+		void query(AABB box, unsigned mask, std::vector<SolidObject*>& results);
 	};
 }
 
-#endif // BROADPHASE_H
\ No newline at end of file
+#endif // BROADPHASE_H
@@ -0,0 +1,31 @@
+#include "StaticGeometry.h"
+
+namespace metalwalrus
+{
+	void StaticGeometry::add(const AABB& box, bool oneWay)
+	{
+		Rect r = { box, oneWay };
+		rects.push_back(r);
+	}
+
+	void StaticGeometry::bake(int width, int height, float cellWidth, float cellHeight)
+	{
+		std::vector<int> indices(rects.size());
+		for (int i = 0; i < rects.size(); i++)
+			indices[i] = i;
+		grid.bake(indices, width, height, cellWidth, cellHeight);
+	}
+
+	void StaticGeometry::clear()
+	{
+		rects.clear();
+		grid.clear();
+	}
+
+	void StaticGeometry::query(AABB box, std::vector<int>& results) const
+	{
+		grid.query(box, results,
+			[](int) { return true; },
+			[](int index) { return index; });
+	}
+}
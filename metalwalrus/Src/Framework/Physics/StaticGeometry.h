@@ -0,0 +1,49 @@
+#ifndef STATICGEOMETRY_H
+#define STATICGEOMETRY_H
+#pragma once
+
+#include <vector>
+
+#include "AABB.h"
+#include "BakedGrid.h"
+
+namespace metalwalrus
+{
+	// the level's solid rectangles, built once when the level loads and
+	// bucketed into a coarse grid so queries only visit nearby rectangles
+	class StaticGeometry
+	{
+	public:
+		struct Rect
+		{
+			AABB box;
+			bool oneWay;
+		};
+	private:
+		struct RectBounds
+		{
+			const std::vector<Rect> *rects;
+			const AABB& operator()(int index) const { return (*rects)[index].box; }
+		};
+
+		std::vector<Rect> rects;
+		BakedGrid<int, RectBounds> grid; // indices into rects
+	public:
+		StaticGeometry() : grid(RectBounds { &rects }) { }
+		// the grid points at rects
+		StaticGeometry(const StaticGeometry&) = delete;
+		StaticGeometry& operator=(const StaticGeometry&) = delete;
+
+		void add(const AABB& box, bool oneWay);
+		void bake(int width, int height, float cellWidth, float cellHeight);
+		void clear();
+
+		inline int get_rectCount() const { return rects.size(); }
+		inline const Rect& get_rect(int index) const { return rects[index]; }
+
+		// appends the index of every rect whose bounds intersect box
+		void query(AABB box, std::vector<int>& results) const;
+	};
+}
+
+#endif // STATICGEOMETRY_H
@@ -0,0 +1,42 @@
+#include "TriggerIndex.h"
+
+#include "../Game/SolidObject.h"
+
+namespace metalwalrus
+{
+	AABB TriggerIndex::TriggerBounds::operator()(const Trigger& t) const
+	{
+		return t.object->get_boundingBox();
+	}
+
+	void TriggerIndex::add(SolidObject *trigger, unsigned type)
+	{
+		Trigger t = { trigger, type };
+		pending.push_back(t);
+	}
+
+	void TriggerIndex::bake(int width, int height, float cellWidth, float cellHeight)
+	{
+		grid.bake(pending, width, height, cellWidth, cellHeight);
+	}
+
+	void TriggerIndex::clear()
+	{
+		pending.clear();
+		grid.clear();
+	}
+
+	void TriggerIndex::query(AABB box, unsigned typeMask, std::vector<SolidObject*>& results) const
+	{
+		grid.query(box, results,
+			[typeMask](const Trigger& t) { return (t.type & typeMask) != 0; },
+			[](const Trigger& t) { return t.object; });
+	}
+
+	unsigned TriggerIndex::queryTypes(AABB box) const
+	{
+		unsigned types = 0;
+		grid.visit(box, [&types](const Trigger& t) { types |= t.type; });
+		return types;
+	}
+}
@@ -0,0 +1,43 @@
+#ifndef TRIGGERINDEX_H
+#define TRIGGERINDEX_H
+#pragma once
+
+#include <vector>
+
+#include "AABB.h"
+#include "BakedGrid.h"
+
+namespace metalwalrus
+{
+	class SolidObject; // forward declaration
+
+	// per-tile lookup grid for static trigger volumes, triggers are added
+	// while a level loads and baked once, queries only visit overlapped cells
+	class TriggerIndex
+	{
+		struct Trigger
+		{
+			SolidObject *object;
+			unsigned type; // bit, queries filter on a mask of these
+		};
+
+		struct TriggerBounds
+		{
+			AABB operator()(const Trigger& t) const;
+		};
+
+		std::vector<Trigger> pending; // added since the last bake
+		BakedGrid<Trigger, TriggerBounds> grid;
+	public:
+		void add(SolidObject *trigger, unsigned type);
+		void bake(int width, int height, float cellWidth, float cellHeight);
+		void clear();
+
+		// appends the triggers of a type in typeMask whose bounds intersect box
+		void query(AABB box, unsigned typeMask, std::vector<SolidObject*>& results) const;
+		// union of the types of every trigger intersecting box
+		unsigned queryTypes(AABB box) const;
+	};
+}
+
+#endif // TRIGGERINDEX_H
@@ -3,49 +3,162 @@
 #include <algorithm>
 
 #include "../Game/GameObject.h"
+#include "../Game/ObjectPool.h"
+#include "../Game/SolidObject.h"
+#include "../Util/Hash.h"
 
 namespace metalwalrus
 {
+	std::vector<GameObject*>& IScene::get_tagBucket(TagID tag)
+	{
+		if (tag >= tagBuckets.size())
+			tagBuckets.resize(tag + 1);
+		return tagBuckets[tag];
+	}
+
+	void IScene::addToTagBucket(GameObject *obj)
+	{
+		std::vector<GameObject*>& bucket = get_tagBucket(obj->tag);
+		obj->tagIndex = bucket.size();
+		bucket.push_back(obj);
+	}
+
+	void IScene::removeFromTagBucket(GameObject *obj)
+	{
+		if (obj->tagIndex < 0)
+			return;
+
+		// swap with the last object in the bucket and pop
+		std::vector<GameObject*>& bucket = get_tagBucket(obj->tag);
+		GameObject *last = bucket.back();
+		bucket[obj->tagIndex] = last;
+		last->tagIndex = obj->tagIndex;
+		bucket.pop_back();
+		obj->tagIndex = -1;
+	}
+
+	void IScene::freeSlot(int index)
+	{
+		slots[index].object = nullptr;
+		slots[index].generation++;
+		freeSlots.push_back(index);
+	}
+
+	void IScene::deleteObject(GameObject *obj)
+	{
+		if (obj->pool != nullptr)
+			obj->pool->release(obj);
+		else
+			delete obj;
+	}
+
 	void IScene::registerObject(GameObject* obj)
 	{
+		int index;
+		if (freeSlots.size() > 0)
+		{
+			index = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else
+		{
+			index = slots.size();
+			ObjectSlot slot = { nullptr, 0 };
+			slots.push_back(slot);
+		}
+		slots[index].object = obj;
+		obj->id = ObjectHandle(index, slots[index].generation);
+
 		objects.push_back(obj);
+		addToTagBucket(obj);
 		obj->set_parentScene(this);
+
+		SolidObject *solid = dynamic_cast<SolidObject*>(obj);
+		if (solid != nullptr && solid->get_collisionLayer() != 0)
+			broadPhase.add(solid);
+
 		obj->start();
 	}
 
 	void IScene::destroyObject(GameObject* obj)
 	{
-		objects.erase(std::remove(objects.begin(), objects.end(), obj));
-		delete obj;
+		if (obj->destroyed)
+			return;
+
+		obj->destroyed = true;
+		removeFromTagBucket(obj);
+		SolidObject *solid = dynamic_cast<SolidObject*>(obj);
+		if (solid != nullptr)
+			broadPhase.remove(solid);
+		freeSlot(obj->id.index);
+		destroyQueue.push_back(obj);
+	}
+
+	void IScene::flushDestroyed()
+	{
+		if (destroyQueue.size() == 0)
+			return;
+
+		// stable compaction so draw order is preserved
+		objects.erase(std::remove_if(objects.begin(), objects.end(),
+			[](GameObject *o) { return o->destroyed; }), objects.end());
+
+		for (auto o : destroyQueue)
+			deleteObject(o);
+		destroyQueue.clear();
 	}
 
 	void IScene::destroyAllObjects()
 	{
 		this->updateable = false;
+		broadPhase.clear();
 		for (auto o : objects)
-			delete o;
+			deleteObject(o);
 		objects.clear();
+		destroyQueue.clear(); // queued objects are still in objects
+		for (auto& bucket : tagBuckets)
+			bucket.clear();
+		for (int i = 0; i < slots.size(); i++)
+		{
+			if (slots[i].object != nullptr)
+				freeSlot(i);
+		}
 		this->updateable = true;
 	}
 
-	GameObject *IScene::getWithID(int id)
+	GameObject *IScene::getWithID(ObjectHandle id)
 	{
-		for (int i = 0; i < objects.size(); i++)
-		{
-			if (objects[i]->get_ID() == id)
-				return objects[i];
-		}
-		return nullptr;
+		if (id.index < 0 || id.index >= slots.size())
+			return nullptr;
+		const ObjectSlot& slot = slots[id.index];
+		if (slot.generation != id.generation)
+			return nullptr;
+		return slot.object;
+	}
+
+	const std::vector<GameObject*>& IScene::getWithTag(TagID tag)
+	{
+		return get_tagBucket(tag);
+	}
+
+	const std::vector<GameObject*>& IScene::getWithTag(const std::string& tag)
+	{
+		return get_tagBucket(Tag::intern(tag));
 	}
 
-	std::vector<GameObject*> IScene::getWithTag(const std::string & tag)
+	uint32_t IScene::hashState(uint32_t hash) const
 	{
-		std::vector<GameObject*> returnVal;
-		for (int i = 0; i < objects.size(); i++)
+		using utilities::Hash;
+		hash = Hash::add(hash, (int)objects.size());
+		for (auto obj : objects)
 		{
-			if (objects[i]->get_tag() == tag)
-				returnVal.push_back(objects[i]);
+			if (obj->is_destroyed())
+				continue;
+			Vector2 pos = obj->get_position();
+			hash = Hash::add(hash, obj->get_tag());
+			hash = Hash::add(hash, pos.x);
+			hash = Hash::add(hash, pos.y);
 		}
-		return returnVal;
+		return hash;
 	}
-}
\ No newline at end of file
+}
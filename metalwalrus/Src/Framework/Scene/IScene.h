@@ -2,17 +2,50 @@
 #define SCENE_H
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <string>
 #include <vector>
 
+#include "../Game/Tag.h"
+#include "../Game/ObjectHandle.h"
+#include "../Physics/BroadPhase.h"
+
 namespace metalwalrus
 {
 	class GameObject; // forward declaration
 	
 	class IScene
 	{
+		struct ObjectSlot
+		{
+			GameObject *object;
+			int generation;
+		};
+
+		// slot map backing getWithID, freed slots are reused via freeSlots
+		std::vector<ObjectSlot> slots;
+		std::vector<int> freeSlots;
+
+		void freeSlot(int index);
+		static void deleteObject(GameObject *obj);
+
+		// objects bucketed by TagID, a deque so bucket references stay
+		// valid when new tags are added
+		std::deque<std::vector<GameObject*>> tagBuckets;
+
+		std::vector<GameObject*>& get_tagBucket(TagID tag);
+		void addToTagBucket(GameObject *obj);
+		void removeFromTagBucket(GameObject *obj);
+		std::vector<GameObject*> destroyQueue;
+
+		BroadPhase broadPhase;
 	protected:
 		std::vector<GameObject*> objects;
 		bool updateable;
+
+		// deletes objects queued by destroyObject, call once at the end of update
+		void flushDestroyed();
 	public:
 		virtual ~IScene()
 		{
@@ -24,13 +57,24 @@ namespace metalwalrus
 		virtual void draw() = 0;
 
 		bool get_updateable() const { return updateable; }
+		BroadPhase& get_broadPhase() { return broadPhase; }
 
 		void registerObject(GameObject *obj);
+		// the object stops being found by lookups immediately but is only
+		// deleted when the scene flushes, so it is safe to destroy yourself
 		void destroyObject(GameObject *obj);
 		void destroyAllObjects();
-		GameObject *getWithID(int id);
-		std::vector<GameObject*> getWithTag(const std::string& tag);
+
+		// returns nullptr if the object has been destroyed
+		GameObject *getWithID(ObjectHandle id);
+
+		// the returned bucket is live, it stays valid for the life of the scene
+		const std::vector<GameObject*>& getWithTag(TagID tag);
+		const std::vector<GameObject*>& getWithTag(const std::string& tag);
+
+		// fingerprint of the simulation, replays compare it every tick
+		virtual uint32_t hashState(uint32_t hash) const;
 	};
 }
 
-#endif // SCENE_H
\ No newline at end of file
+#endif // SCENE_H
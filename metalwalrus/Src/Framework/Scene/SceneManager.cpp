@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include "../Audio/AudioLocator.h"
+#include "../Util/Hash.h"
 
 namespace metalwalrus
 {
@@ -47,6 +48,14 @@ namespace metalwalrus
 		for (auto s : scenes)
 			delete s;
 		scenes.clear();
-		AudioLocator::getAudio().stopAllSounds();
+		AudioLocator::getAudio().stopAllSounds(); // also flushes sounds still queued by the old scenes
+	}
+
+	uint32_t SceneManager::hashState()
+	{
+		uint32_t hash = utilities::Hash::SEED;
+		for (auto scene : scenes)
+			hash = scene->hashState(hash);
+		return hash;
 	}
 }
@@ -2,6 +2,7 @@
 #define SCENEMANAGER_H
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "IScene.h"
@@ -20,6 +21,7 @@ namespace metalwalrus
 		static void draw();
 		static void switchScene(IScene* scene);
 		static void clearScenes();
+		static uint32_t hashState();
 	};
 }
 
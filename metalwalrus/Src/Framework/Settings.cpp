@@ -12,6 +12,7 @@ namespace metalwalrus
 	int Settings::VIEWPORT_HEIGHT = 0;
 	int Settings::VIEWPORT_X = 0;
 	int Settings::VIEWPORT_Y = 0;
+	bool Settings::HEADLESS = false;
 
 	Settings::Settings() {}
 }
\ No newline at end of file
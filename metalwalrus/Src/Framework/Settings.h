@@ -18,6 +18,7 @@ namespace metalwalrus
 		static int VIEWPORT_HEIGHT;
 		static int VIEWPORT_X;
 		static int VIEWPORT_Y;
+		static bool HEADLESS; // no GL context, textures and buffers keep their data but never reach the GPU
 	};
 }
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "IStateMachine.h"
+#include "../Util/FreeListAllocator.h"
 
 namespace metalwalrus
 {
@@ -20,7 +21,11 @@ namespace metalwalrus
 		virtual void exit(T& o) = 0;
 		virtual void update(double delta, T& o) = 0;
 
-		std::string get_name() const { return this->name; }
+		const std::string& get_name() const { return this->name; }
+
+		// machines create a state on every transition, so recycle the memory
+		static void *operator new(size_t size) { return FreeListAllocator::allocate(size); }
+		static void operator delete(void *state, size_t size) { FreeListAllocator::release(state, size); }
 	};
 }
 
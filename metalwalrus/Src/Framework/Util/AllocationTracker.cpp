@@ -0,0 +1,123 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace metalwalrus
+{
+	std::atomic<long long> AllocationTracker::allocs(0);
+	std::atomic<long long> AllocationTracker::frees(0);
+	std::atomic<long long> AllocationTracker::bytes(0);
+	std::atomic<long long> AllocationTracker::simulationAllocs(0);
+	std::atomic<long long> AllocationTracker::simulationFrees(0);
+	std::atomic<long long> AllocationTracker::simulationBytes(0);
+	AllocationCounts AllocationTracker::frameStart = {};
+	AllocationCounts AllocationTracker::lastFrame = {};
+
+	static thread_local AllocationCounts threadCounts = {};
+	static thread_local bool simulationThread = false;
+
+	AllocationCounts AllocationTracker::get_total()
+	{
+		AllocationCounts counts = {
+			allocs.load(std::memory_order_relaxed),
+			frees.load(std::memory_order_relaxed),
+			bytes.load(std::memory_order_relaxed)
+		};
+		return counts;
+	}
+
+	AllocationCounts AllocationTracker::get_thread()
+	{
+		return threadCounts;
+	}
+
+	AllocationCounts AllocationTracker::get_simulation()
+	{
+		AllocationCounts counts = {
+			simulationAllocs.load(std::memory_order_relaxed),
+			simulationFrees.load(std::memory_order_relaxed),
+			simulationBytes.load(std::memory_order_relaxed)
+		};
+		return counts;
+	}
+
+	void AllocationTracker::set_simulationThread()
+	{
+		simulationThread = true;
+	}
+
+	void AllocationTracker::endFrame()
+	{
+		AllocationCounts now = get_total();
+		lastFrame = now - frameStart;
+		frameStart = now;
+	}
+
+	void AllocationTracker::recordAlloc(size_t size)
+	{
+		allocs.fetch_add(1, std::memory_order_relaxed);
+		bytes.fetch_add(size, std::memory_order_relaxed);
+		threadCounts.allocs++;
+		threadCounts.bytes += size;
+		if (simulationThread)
+		{
+			simulationAllocs.fetch_add(1, std::memory_order_relaxed);
+			simulationBytes.fetch_add(size, std::memory_order_relaxed);
+		}
+	}
+
+	void AllocationTracker::recordFree()
+	{
+		frees.fetch_add(1, std::memory_order_relaxed);
+		threadCounts.frees++;
+		if (simulationThread)
+			simulationFrees.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+#if TRACK_ALLOCATIONS
+
+using metalwalrus::AllocationTracker;
+
+static void *trackedAlloc(size_t size)
+{
+	AllocationTracker::recordAlloc(size);
+	return malloc(size > 0 ? size : 1);
+}
+
+static void trackedFree(void *block)
+{
+	if (block == nullptr)
+		return;
+	AllocationTracker::recordFree();
+	free(block);
+}
+
+void *operator new(size_t size)
+{
+	void *block = trackedAlloc(size);
+	if (block == nullptr)
+		throw std::bad_alloc();
+	return block;
+}
+
+void *operator new[](size_t size)
+{
+	void *block = trackedAlloc(size);
+	if (block == nullptr)
+		throw std::bad_alloc();
+	return block;
+}
+
+void *operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+
+void operator delete(void *block) noexcept { trackedFree(block); }
+void operator delete[](void *block) noexcept { trackedFree(block); }
+void operator delete(void *block, size_t) noexcept { trackedFree(block); }
+void operator delete[](void *block, size_t) noexcept { trackedFree(block); }
+void operator delete(void *block, const std::nothrow_t&) noexcept { trackedFree(block); }
+void operator delete[](void *block, const std::nothrow_t&) noexcept { trackedFree(block); }
+
+#endif // TRACK_ALLOCATIONS
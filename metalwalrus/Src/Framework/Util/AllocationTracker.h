@@ -0,0 +1,69 @@
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// when TRACK_ALLOCATIONS is 1 the global operator new and delete are
+// replaced with versions that count every call. on in debug builds
+#ifndef TRACK_ALLOCATIONS
+#ifdef _DEBUG
+#define TRACK_ALLOCATIONS 1
+#else
+#define TRACK_ALLOCATIONS 0
+#endif
+#endif
+
+namespace metalwalrus
+{
+	struct AllocationCounts
+	{
+		long long allocs;
+		long long frees;
+		long long bytes; // requested by allocs, frees don't subtract
+
+		AllocationCounts operator-(const AllocationCounts& other) const
+		{
+			AllocationCounts result = { allocs - other.allocs, frees - other.frees, bytes - other.bytes };
+			return result;
+		}
+	};
+
+	class AllocationTracker
+	{
+		static std::atomic<long long> allocs;
+		static std::atomic<long long> frees;
+		static std::atomic<long long> bytes;
+		static std::atomic<long long> simulationAllocs;
+		static std::atomic<long long> simulationFrees;
+		static std::atomic<long long> simulationBytes;
+
+		static AllocationCounts frameStart;
+		static AllocationCounts lastFrame;
+
+		AllocationTracker(); // static class
+	public:
+		static bool is_enabled() { return TRACK_ALLOCATIONS != 0; }
+
+		// every thread since startup
+		static AllocationCounts get_total();
+		// only the calling thread, used to charge profiler sections
+		static AllocationCounts get_thread();
+		// only threads that called set_simulationThread, the main thread and
+		// the job workers. background threads like the logger's writer
+		// allocate whenever they wake up, which isn't any tick's doing
+		static AllocationCounts get_simulation();
+		static void set_simulationThread();
+
+		// called once a frame by the main loop, closes the frame's counts
+		static void endFrame();
+		static const AllocationCounts& get_lastFrame() { return lastFrame; }
+
+		// used by the operator new and delete replacements
+		static void recordAlloc(size_t size);
+		static void recordFree();
+	};
+}
+
+#endif // ALLOCATIONTRACKER_H
@@ -3,6 +3,10 @@
 #include <fstream>
 #include <iostream>
 #include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+
+#include "Logger.h"
 
 namespace metalwalrus
 {
@@ -13,30 +17,44 @@ namespace metalwalrus
 	double Debug::fps = 0;
 	bool Debug::debugMode = 0;
 	
-	void Debug::log(const char *message, LogType type)
+	const char *Debug::typeString(LogType type)
 	{
-		char *typeString;
 		switch (type)
 		{
 			case LogType::WARNING:
-			{
-				typeString = "Warning: ";
-			} break;
+				return "Warning: ";
 			case LogType::ERR:
-			{
-				typeString = "Error: ";
-			} break;
+				return "Error: ";
 			case LogType::FATAL:
-			{
-				typeString = "Fatal: ";
-			} break;
+				return "Fatal: ";
 			default:
-			{
-				typeString = "Log: ";
-			} break;
+				return "Log: ";
 		}
+	}
+
+	void Debug::log(const char *message, LogType type)
+	{
+		logf(type, "%s", message);
+	}
 
-		std::clog << typeString << message << std::endl;
+	void Debug::logf(LogType type, const char *format, ...)
+	{
+		va_list args;
+		va_start(args, format);
+		if (Logger::is_running())
+		{
+			Logger::write(type, format, args);
+			// the program may not live long enough for the writer to get to it
+			if (type == LogType::FATAL)
+				Logger::flush();
+		}
+		else
+		{
+			char message[512];
+			vsnprintf(message, sizeof(message), format, args);
+			std::clog << typeString(type) << message << std::endl;
+		}
+		va_end(args);
 	}
 
 	bool Debug::redirect(char *logFilePath)
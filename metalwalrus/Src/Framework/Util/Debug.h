@@ -4,6 +4,33 @@
 
 #include <fstream>
 
+// log calls below LOG_LEVEL compile to nothing, arguments and all.
+// 0 messages, 1 warnings, 2 errors, 3 fatal only
+#ifndef LOG_LEVEL
+#ifdef _DEBUG
+#define LOG_LEVEL 0
+#else
+#define LOG_LEVEL 1
+#endif
+#endif
+
+#if LOG_LEVEL <= 0
+#define LOG_MESSAGE(...) metalwalrus::Debug::logf(metalwalrus::Debug::LogType::MESSAGE, __VA_ARGS__)
+#else
+#define LOG_MESSAGE(...) ((void)0)
+#endif
+#if LOG_LEVEL <= 1
+#define LOG_WARNING(...) metalwalrus::Debug::logf(metalwalrus::Debug::LogType::WARNING, __VA_ARGS__)
+#else
+#define LOG_WARNING(...) ((void)0)
+#endif
+#if LOG_LEVEL <= 2
+#define LOG_ERROR(...) metalwalrus::Debug::logf(metalwalrus::Debug::LogType::ERR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+#define LOG_FATAL(...) metalwalrus::Debug::logf(metalwalrus::Debug::LogType::FATAL, __VA_ARGS__)
+
 namespace metalwalrus
 {
 	class Debug
@@ -27,7 +54,11 @@ namespace metalwalrus
 		};
 
 		static void log(const char *message, LogType type = LogType::MESSAGE);
+		// printf style, goes through the Logger's writer thread once it's
+		// started. prefer the LOG_ macros so the level can be compiled out
+		static void logf(LogType type, const char *format, ...);
 		static bool redirect(char *logFilePath);
+		static const char *typeString(LogType type);
 
 		inline static int get_drawCalls() { return lastDrawCalls; }
 		inline static void set_drawCalls(int dc)
@@ -41,4 +72,4 @@ namespace metalwalrus
 		
 	};
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,76 @@
+#include "FrameArena.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace metalwalrus
+{
+	char *FrameArena::memory = nullptr;
+	size_t FrameArena::capacity = 0;
+	size_t FrameArena::used = 0;
+	size_t FrameArena::highWater = 0;
+	size_t FrameArena::overflowBytes = 0;
+	std::vector<void*> FrameArena::overflow;
+
+	static const size_t initialCapacity = 64 * 1024;
+
+	void *FrameArena::allocate(size_t size, size_t align)
+	{
+		if (memory == nullptr)
+		{
+			capacity = initialCapacity;
+			memory = static_cast<char*>(malloc(capacity));
+		}
+
+		size_t start = (used + align - 1) & ~(align - 1);
+		if (start + size <= capacity)
+		{
+			used = start + size;
+			return memory + start;
+		}
+
+		// out of room, keep going from the heap until the block can grow
+		void *block = malloc(size + align);
+		overflow.push_back(block);
+		overflowBytes += size + align;
+		size_t address = ((size_t)block + align - 1) & ~(align - 1);
+		return reinterpret_cast<void*>(address);
+	}
+
+	void FrameArena::reset()
+	{
+		if (used + overflowBytes > highWater)
+			highWater = used + overflowBytes;
+
+		if (overflow.size() > 0)
+		{
+			for (auto block : overflow)
+				free(block);
+			overflow.clear();
+
+			while (capacity < highWater)
+				capacity *= 2;
+			free(memory);
+			memory = static_cast<char*>(malloc(capacity));
+		}
+
+		used = 0;
+		overflowBytes = 0;
+	}
+
+	const char *FrameArena::format(const char *format, ...)
+	{
+		va_list args;
+		va_start(args, format);
+		va_list measure;
+		va_copy(measure, args);
+		int length = vsnprintf(nullptr, 0, format, measure);
+		va_end(measure);
+
+		char *text = static_cast<char*>(allocate(length + 1, 1));
+		vsnprintf(text, length + 1, format, args);
+		va_end(args);
+		return text;
+	}
+}
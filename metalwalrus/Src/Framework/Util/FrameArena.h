@@ -0,0 +1,63 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace metalwalrus
+{
+	// bump allocator for data that only has to last until the end of the
+	// frame. the main loop resets it once a frame, frees are no-ops. only
+	// the main thread may use it. a frame that runs out falls back to the
+	// heap and the block is grown on reset, so steady frames don't allocate
+	class FrameArena
+	{
+		static char *memory;
+		static size_t capacity;
+		static size_t used;
+		static size_t highWater; // most used in a frame, counting overflow
+		static size_t overflowBytes; // this frame's allocations that didn't fit
+		static std::vector<void*> overflow;
+
+		FrameArena(); // static class
+	public:
+		static void *allocate(size_t size, size_t align = alignof(std::max_align_t));
+		static void reset();
+
+		// printf into the arena
+		static const char *format(const char *format, ...);
+
+		static size_t get_used() { return used + overflowBytes; }
+		static size_t get_capacity() { return capacity; }
+		static size_t get_highWater() { return highWater; }
+	};
+
+	// lets standard containers allocate from the frame arena
+	template <typename T>
+	class FrameAllocator
+	{
+	public:
+		typedef T value_type;
+
+		FrameAllocator() { }
+		template <typename U>
+		FrameAllocator(const FrameAllocator<U>&) { }
+
+		T *allocate(size_t n) { return static_cast<T*>(FrameArena::allocate(n * sizeof(T), alignof(T))); }
+		void deallocate(T*, size_t) { }
+
+		template <typename U>
+		bool operator==(const FrameAllocator<U>&) const { return true; }
+		template <typename U>
+		bool operator!=(const FrameAllocator<U>&) const { return false; }
+	};
+
+	// scratch containers, gone at the end of the frame
+	typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
+	template <typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
+
+#endif // FRAMEARENA_H
@@ -0,0 +1,104 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace metalwalrus
+{
+	double FramePacer::tickLength = 1.0 / 60.0;
+	int FramePacer::maxSteps = 5;
+	double FramePacer::targetFrameTime = 0;
+	int FramePacer::swapInterval = 1;
+	bool FramePacer::interpolate = false;
+
+	FramePacer::Clock::time_point FramePacer::lastFrame;
+	FramePacer::Clock::time_point FramePacer::nextFrame;
+	double FramePacer::accumulator = 0;
+	double FramePacer::frameTime = 0;
+	double FramePacer::alpha = 0;
+	double FramePacer::droppedTime = 0;
+
+	double FramePacer::sleepMean = 0.002; // pessimistic until measured
+	double FramePacer::sleepM2 = 0;
+	int FramePacer::sleepSamples = 1;
+
+	void FramePacer::reset()
+	{
+		lastFrame = Clock::now();
+		nextFrame = lastFrame;
+		accumulator = 0;
+		alpha = 0;
+		droppedTime = 0;
+	}
+
+	int FramePacer::beginFrame()
+	{
+		Clock::time_point now = Clock::now();
+		frameTime = std::chrono::duration<double>(now - lastFrame).count();
+		lastFrame = now;
+
+		accumulator += frameTime;
+
+		// after a stall, run at most maxSteps ticks and let the game fall
+		// behind real time instead of spending the next frame catching up
+		double maxCatchUp = maxSteps * tickLength;
+		if (accumulator > maxCatchUp)
+		{
+			droppedTime += accumulator - maxCatchUp;
+			accumulator = maxCatchUp;
+		}
+
+		int steps = (int)(accumulator / tickLength);
+		accumulator -= steps * tickLength;
+		alpha = accumulator / tickLength;
+		return steps;
+	}
+
+	void FramePacer::endFrame()
+	{
+		if (targetFrameTime <= 0)
+			return;
+
+		Clock::duration frame = std::chrono::duration_cast<Clock::duration>(
+			std::chrono::duration<double>(targetFrameTime));
+		nextFrame += frame;
+
+		// too far behind to make it up, start counting again from now
+		Clock::time_point now = Clock::now();
+		if (now > nextFrame + frame)
+			nextFrame = now;
+
+		sleepUntil(nextFrame);
+	}
+
+	void FramePacer::sleepUntil(Clock::time_point deadline)
+	{
+		while (true)
+		{
+			double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+			double estimate = sleepMean + std::sqrt(sleepM2 / sleepSamples);
+			if (remaining <= estimate)
+				break;
+
+			Clock::time_point start = Clock::now();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			double slept = std::chrono::duration<double>(Clock::now() - start).count();
+
+			// welford's update, restarted now and then so the estimate
+			// follows changes in the scheduler
+			if (sleepSamples > 1000)
+			{
+				sleepSamples = 1;
+				sleepM2 = 0;
+			}
+			sleepSamples++;
+			double delta = slept - sleepMean;
+			sleepMean += delta / sleepSamples;
+			sleepM2 += delta * (slept - sleepMean);
+		}
+
+		while (Clock::now() < deadline)
+			std::this_thread::yield();
+	}
+}
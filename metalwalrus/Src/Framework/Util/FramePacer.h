@@ -0,0 +1,64 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+#pragma once
+
+#include <chrono>
+
+namespace metalwalrus
+{
+	// decides how many fixed ticks each rendered frame runs and holds frames
+	// to a target rate. the limiter sleeps while it safely can, then spins
+	// the last stretch, using how far sleeps have overshot so far to decide
+	// when to stop sleeping
+	class FramePacer
+	{
+		typedef std::chrono::steady_clock Clock;
+
+		static double tickLength;
+		static int maxSteps; // ticks a single frame may run, the rest is dropped
+		static double targetFrameTime; // 0 leaves pacing to vsync
+		static int swapInterval;
+		static bool interpolate;
+
+		static Clock::time_point lastFrame;
+		static Clock::time_point nextFrame;
+		static double accumulator;
+		static double frameTime;
+		static double alpha;
+		static double droppedTime;
+
+		// running mean and deviation of how long a 1 ms sleep really takes,
+		// the whole measured duration in seconds. the limiter stops sleeping
+		// once less than mean plus one deviation is left
+		static double sleepMean;
+		static double sleepM2;
+		static int sleepSamples;
+
+		static void sleepUntil(Clock::time_point deadline);
+
+		FramePacer(); // static class
+	public:
+		static void set_tickLength(double seconds) { tickLength = seconds; }
+		static void set_maxSteps(int steps) { maxSteps = steps; }
+		static void set_targetFps(double fps) { targetFrameTime = fps > 0 ? 1.0 / fps : 0; }
+		static void set_swapInterval(int interval) { swapInterval = interval; }
+		static void set_interpolate(bool interpolate) { FramePacer::interpolate = interpolate; }
+
+		static int get_swapInterval() { return swapInterval; }
+		static bool is_interpolating() { return interpolate; }
+
+		// call once before the first frame
+		static void reset();
+		// measures the last frame and returns how many ticks to run now
+		static int beginFrame();
+		// waits out the rest of the frame if there is a target rate
+		static void endFrame();
+
+		static double get_frameTime() { return frameTime; }
+		// how far between the last two ticks this frame should be drawn
+		static double get_alpha() { return alpha; }
+		static double get_droppedTime() { return droppedTime; } // total catch-up time thrown away
+	};
+}
+
+#endif // FRAMEPACER_H
@@ -0,0 +1,38 @@
+#include "FreeListAllocator.h"
+
+#include <new>
+
+namespace metalwalrus
+{
+	FreeListAllocator::FreeBlock *FreeListAllocator::freeLists[MAX_SIZE / GRANULARITY] = {};
+
+	void *FreeListAllocator::allocate(size_t size)
+	{
+		if (size == 0 || size > MAX_SIZE)
+			return ::operator new(size);
+
+		size_t sizeClass = (size - 1) / GRANULARITY;
+		FreeBlock *block = freeLists[sizeClass];
+		if (block == nullptr)
+			return ::operator new((sizeClass + 1) * GRANULARITY);
+
+		freeLists[sizeClass] = block->next;
+		return block;
+	}
+
+	void FreeListAllocator::release(void *block, size_t size)
+	{
+		if (block == nullptr)
+			return;
+		if (size == 0 || size > MAX_SIZE)
+		{
+			::operator delete(block);
+			return;
+		}
+
+		size_t sizeClass = (size - 1) / GRANULARITY;
+		FreeBlock *freed = static_cast<FreeBlock*>(block);
+		freed->next = freeLists[sizeClass];
+		freeLists[sizeClass] = freed;
+	}
+}
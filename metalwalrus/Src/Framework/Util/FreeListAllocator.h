@@ -0,0 +1,30 @@
+#ifndef FREELISTALLOCATOR_H
+#define FREELISTALLOCATOR_H
+#pragma once
+
+#include <cstddef>
+
+namespace metalwalrus
+{
+	// keeps freed small blocks on a list per size class so objects that are
+	// made and thrown away all the time (state machine states) stop hitting
+	// the heap once the game has warmed up. main thread only
+	class FreeListAllocator
+	{
+		static const size_t GRANULARITY = 16;
+		static const size_t MAX_SIZE = 256; // bigger blocks go straight to the heap
+
+		struct FreeBlock
+		{
+			FreeBlock *next;
+		};
+		static FreeBlock *freeLists[MAX_SIZE / GRANULARITY];
+
+		FreeListAllocator(); // static class
+	public:
+		static void *allocate(size_t size);
+		static void release(void *block, size_t size);
+	};
+}
+
+#endif // FREELISTALLOCATOR_H
@@ -2,9 +2,11 @@
 
 #include <GL/glew.h>
 
-#include <iostream>
+#include <string>
 using namespace std;
 
+#include "Debug.h"
+
 void _check_gl_error(const char *file, int line)
 {
 	GLenum err(glGetError());
@@ -22,7 +24,7 @@ void _check_gl_error(const char *file, int line)
 			case GL_INVALID_FRAMEBUFFER_OPERATION:  error = "INVALID_FRAMEBUFFER_OPERATION";  break;
 		}
 
-		cerr << "GL_" << error.c_str() << " - " << file << ":" << line << endl;
+		LOG_ERROR("GL_%s - %s:%d", error.c_str(), file, line);
 		err = glGetError();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef HASH_H
+#define HASH_H
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace metalwalrus
+{
+	namespace utilities
+	{
+		// FNV-1a, used to fingerprint game state for replays
+		class Hash
+		{
+			Hash(); // static class
+		public:
+			static const uint32_t SEED = 2166136261u;
+
+			static uint32_t bytes(uint32_t hash, const void *data, size_t size)
+			{
+				const uint8_t *b = (const uint8_t*)data;
+				for (size_t i = 0; i < size; i++)
+				{
+					hash ^= b[i];
+					hash *= 16777619u;
+				}
+				return hash;
+			}
+
+			static uint32_t add(uint32_t hash, int value) { return bytes(hash, &value, sizeof(value)); }
+			static uint32_t add(uint32_t hash, float value) { return bytes(hash, &value, sizeof(value)); }
+		};
+	}
+}
+
+#endif // HASH_H
@@ -14,7 +14,7 @@ namespace metalwalrus
 
 			if (error != 0)
 			{
-				Debug::log(lodepng_error_text(error), Debug::LogType::ERR);
+				LOG_ERROR("%s", lodepng_error_text(error));
 				return nullptr;
 			}
 
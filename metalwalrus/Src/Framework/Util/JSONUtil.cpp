@@ -111,13 +111,53 @@ namespace metalwalrus
 					
 					i++;
 				}
+				layerObject->buildMasks();
 
 				layerNum++;
 			}
+			tm->buildCollision();
 
 			return tm;
 		}
 
+		AnimatedSprite *JSONUtil::animated_sprite(std::string filePath, SpriteSheet *sheet, int frameOffset)
+		{
+			AnimatedSprite *sprite = new AnimatedSprite(sheet);
+
+			picojson::value *json = jsonValueFromFile(filePath);
+			if (json == nullptr)
+				return sprite;
+
+			picojson::array clips = json->get("animations").get<picojson::array>();
+			for (auto clip : clips)
+			{
+				int frames = (int)clip.get("frames").get<double>();
+				int start = (int)clip.get("start").get<double>() + frameOffset;
+				float length = (float)clip.get("length").get<double>();
+				sprite->addAnimation(clip.get("name").get<std::string>(), 
+					FrameAnimation(frames, start, length));
+			}
+
+			// resolve chained clips now that every name has a handle
+			for (auto clip : clips)
+			{
+				if (!clip.contains("next"))
+					continue;
+				
+				AnimationID anim = sprite->get_animationID(clip.get("name").get<std::string>());
+				AnimationID next = sprite->get_animationID(clip.get("next").get<std::string>());
+				if (next == NO_ANIMATION)
+				{
+					LOG_WARNING("Animation chained to unknown clip in %s", filePath.c_str());
+					continue;
+				}
+				sprite->chainAnimation(anim, next);
+			}
+
+			delete json;
+			return sprite;
+		}
+
 		picojson::value *JSONUtil::jsonValueFromFile(std::string filePath)
 		{
 			std::ifstream jsonFile;
@@ -126,7 +166,7 @@ namespace metalwalrus
 			jsonFile >> *v;
 			if (jsonFile.fail())
 			{
-				Debug::log(picojson::get_last_error().c_str(), Debug::LogType::ERR);
+				LOG_ERROR("%s", picojson::get_last_error().c_str());
 				return nullptr;
 			}
 			jsonFile.close();
@@ -4,6 +4,7 @@
 
 #include "../Graphics/SpriteSheet.h"
 #include "../Graphics/TileMap.h"
+#include "../Animation/AnimatedSprite.h"
 
 namespace metalwalrus
 {
@@ -17,6 +18,8 @@ namespace metalwalrus
 		public:
 			static SpriteSheet *tiled_spritesheet(std::string filePath);
 			static TileMap *tiled_tilemap(std::string filePath, Camera *cam);
+			// frameOffset is added to every clip's start frame, for sheets with variants
+			static AnimatedSprite *animated_sprite(std::string filePath, SpriteSheet *sheet, int frameOffset = 0);
 
 			static picojson::value *jsonValueFromFile(std::string filePath);
 		};
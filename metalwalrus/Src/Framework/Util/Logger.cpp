@@ -0,0 +1,159 @@
+#include "Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+namespace metalwalrus
+{
+	std::vector<Logger::ThreadBuffer*> Logger::buffers;
+	std::mutex Logger::buffersLock;
+	thread_local Logger::ThreadBuffer *Logger::localBuffer = nullptr;
+	thread_local unsigned Logger::localGeneration = 0;
+	std::atomic<unsigned> Logger::generation(1);
+
+	std::atomic<uint64_t> Logger::sequence(0);
+	std::atomic<bool> Logger::running(false);
+	std::thread Logger::writer;
+	std::mutex Logger::sleepLock;
+	std::condition_variable Logger::wake;
+	std::condition_variable Logger::flushed;
+	uint64_t Logger::flushesRequested = 0;
+	uint64_t Logger::flushesDone = 0;
+
+	void Logger::start()
+	{
+		if (running)
+			return;
+		running = true;
+		writer = std::thread(writerLoop);
+	}
+
+	void Logger::stop()
+	{
+		if (!running)
+			return;
+		{
+			std::lock_guard<std::mutex> guard(sleepLock);
+			running = false;
+		}
+		wake.notify_one();
+		writer.join();
+
+		std::lock_guard<std::mutex> guard(buffersLock);
+		for (auto b : buffers)
+			delete b;
+		buffers.clear();
+		generation++;
+	}
+
+	Logger::ThreadBuffer *Logger::threadBuffer()
+	{
+		if (localBuffer == nullptr || localGeneration != generation)
+		{
+			std::lock_guard<std::mutex> guard(buffersLock);
+			localBuffer = new ThreadBuffer();
+			localBuffer->dropped = 0;
+			localGeneration = generation;
+			buffers.push_back(localBuffer);
+		}
+		return localBuffer;
+	}
+
+	void Logger::write(Debug::LogType type, const char *format, va_list args)
+	{
+		ThreadBuffer *buffer = threadBuffer();
+		Entry *entry = buffer->entries.reserve();
+		while (entry == nullptr)
+		{
+			// chatter can be lost, errors are worth waiting for
+			if (type == Debug::LogType::MESSAGE || type == Debug::LogType::WARNING)
+			{
+				buffer->dropped++;
+				return;
+			}
+			flush();
+			entry = buffer->entries.reserve();
+		}
+
+		entry->sequence = sequence++;
+		entry->type = type;
+		vsnprintf(entry->text, MAX_LENGTH, format, args);
+		buffer->entries.commit();
+
+		// don't leave a busy thread's ring to fill up before the next pass
+		if (buffer->entries.size() == buffer->entries.capacity() / 2)
+			wake.notify_one();
+	}
+
+	void Logger::flush()
+	{
+		if (!running)
+			return;
+		std::unique_lock<std::mutex> lock(sleepLock);
+		uint64_t request = ++flushesRequested;
+		wake.notify_one();
+		flushed.wait(lock, [request]() { return flushesDone >= request || !running; });
+	}
+
+	void Logger::drain(std::vector<Entry>& batch)
+	{
+		int dropped = 0;
+		{
+			std::lock_guard<std::mutex> guard(buffersLock);
+			for (auto b : buffers)
+			{
+				const Entry *e;
+				while ((e = b->entries.front()) != nullptr)
+				{
+					batch.push_back(*e);
+					b->entries.release();
+				}
+				dropped += b->dropped.exchange(0);
+			}
+		}
+		if (batch.size() == 0 && dropped == 0)
+			return;
+
+		// threads were drained one after another, put them back in order
+		std::sort(batch.begin(), batch.end(), [](const Entry& a, const Entry& b) {
+			return a.sequence < b.sequence;
+		});
+		for (auto& e : batch)
+			std::clog << Debug::typeString(e.type) << e.text << '\n';
+		if (dropped > 0)
+			std::clog << Debug::typeString(Debug::LogType::WARNING) << dropped << " log messages dropped\n";
+		std::clog.flush();
+		batch.clear();
+	}
+
+	void Logger::writerLoop()
+	{
+		std::vector<Entry> batch;
+		while (true)
+		{
+			uint64_t request;
+			bool stopping;
+			{
+				std::unique_lock<std::mutex> lock(sleepLock);
+				wake.wait_for(lock, std::chrono::milliseconds(10), []() {
+					return !running || flushesRequested > flushesDone;
+				});
+				request = flushesRequested;
+				stopping = !running;
+			}
+
+			drain(batch);
+
+			{
+				std::lock_guard<std::mutex> guard(sleepLock);
+				flushesDone = request;
+			}
+			flushed.notify_all();
+
+			if (stopping)
+				return;
+		}
+	}
+}
@@ -0,0 +1,70 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Debug.h"
+#include "SPSCQueue.h"
+
+namespace metalwalrus
+{
+	// moves log output off the calling thread. each thread formats into its
+	// own lock free ring, and a writer thread drains them every few ms and
+	// writes the batch to std::clog in the order it was logged
+	class Logger
+	{
+		static const int MAX_LENGTH = 240; // longer messages are cut short
+
+		struct Entry
+		{
+			uint64_t sequence;
+			Debug::LogType type;
+			char text[MAX_LENGTH];
+		};
+
+		struct ThreadBuffer
+		{
+			SPSCQueue<Entry, 256> entries;
+			std::atomic<int> dropped; // messages lost to a full ring
+		};
+
+		static std::vector<ThreadBuffer*> buffers;
+		static std::mutex buffersLock; // only taken when a thread first logs
+		static thread_local ThreadBuffer *localBuffer;
+		static thread_local unsigned localGeneration;
+		static std::atomic<unsigned> generation; // bumped by stop, so stale thread buffers get replaced
+
+		static std::atomic<uint64_t> sequence;
+		static std::atomic<bool> running;
+		static std::thread writer;
+		static std::mutex sleepLock;
+		static std::condition_variable wake;
+		static std::condition_variable flushed;
+		static uint64_t flushesRequested;
+		static uint64_t flushesDone;
+
+		static ThreadBuffer *threadBuffer();
+		static void drain(std::vector<Entry>& batch);
+		static void writerLoop();
+
+		Logger(); // static class
+	public:
+		static void start();
+		// writes anything still queued
+		static void stop();
+		static bool is_running() { return running; }
+
+		static void write(Debug::LogType type, const char *format, va_list args);
+		// blocks until everything logged so far has been written
+		static void flush();
+	};
+}
+
+#endif // LOGGER_H
@@ -0,0 +1,46 @@
+#include "Profiler.h"
+
+namespace metalwalrus
+{
+	bool Profiler::enabled = false;
+
+	std::vector<Profiler::Section>& Profiler::sections()
+	{
+		// function-local so sections can be registered during static initialization
+		static std::vector<Section> allSections;
+		return allSections;
+	}
+
+	ProfileSection Profiler::section(const std::string& name)
+	{
+		std::vector<Section>& s = sections();
+		for (int i = 0; i < s.size(); i++)
+		{
+			if (s[i].name == name)
+				return i;
+		}
+		Section newSection = { name, 0, 0, 0, 0 };
+		s.push_back(newSection);
+		return s.size() - 1;
+	}
+
+	void Profiler::add(ProfileSection section, double seconds, const AllocationCounts& allocations)
+	{
+		Section& s = sections()[section];
+		s.total += seconds;
+		s.calls++;
+		s.allocs += allocations.allocs;
+		s.bytes += allocations.bytes;
+	}
+
+	void Profiler::reset()
+	{
+		for (auto& s : sections())
+		{
+			s.total = 0;
+			s.calls = 0;
+			s.allocs = 0;
+			s.bytes = 0;
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "AllocationTracker.h"
+
+namespace metalwalrus
+{
+	// handle to a named timing section, index into the profiler's tables
+	typedef int ProfileSection;
+
+	// accumulates wall time per named section, off unless something turns
+	// it on (the headless runner does), so the game doesn't pay for the clock.
+	// with allocation tracking built in, sections also count the allocations
+	// made on the thread that opened them
+	class Profiler
+	{
+		struct Section
+		{
+			std::string name;
+			double total; // seconds
+			int calls;
+			long long allocs;
+			long long bytes;
+		};
+
+		Profiler(); // static class
+
+		static std::vector<Section>& sections();
+	public:
+		static bool enabled;
+
+		static ProfileSection section(const std::string& name);
+		static void add(ProfileSection section, double seconds,
+			const AllocationCounts& allocations = AllocationCounts());
+		static void reset();
+
+		static int get_sectionCount() { return sections().size(); }
+		static const std::string& get_name(ProfileSection section) { return sections()[section].name; }
+		static double get_total(ProfileSection section) { return sections()[section].total; }
+		static int get_calls(ProfileSection section) { return sections()[section].calls; }
+		static long long get_allocs(ProfileSection section) { return sections()[section].allocs; }
+		static long long get_bytes(ProfileSection section) { return sections()[section].bytes; }
+	};
+
+	// times the enclosing block into a section
+	class ProfileScope
+	{
+		typedef std::chrono::steady_clock Clock;
+
+		ProfileSection section;
+		Clock::time_point start;
+		AllocationCounts startAllocations;
+	public:
+		ProfileScope(ProfileSection section) : section(section)
+		{
+			if (Profiler::enabled)
+			{
+				start = Clock::now();
+				if (AllocationTracker::is_enabled())
+					startAllocations = AllocationTracker::get_thread();
+			}
+		}
+
+		~ProfileScope()
+		{
+			if (Profiler::enabled)
+			{
+				AllocationCounts allocations = AllocationCounts();
+				if (AllocationTracker::is_enabled())
+					allocations = AllocationTracker::get_thread() - startAllocations;
+				Profiler::add(section, std::chrono::duration<double>(Clock::now() - start).count(), allocations);
+			}
+		}
+	};
+}
+
+#endif // PROFILER_H
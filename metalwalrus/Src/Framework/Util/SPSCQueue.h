@@ -0,0 +1,102 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace metalwalrus
+{
+	// fixed size ring buffer for exactly one producer thread and one
+	// consumer thread, neither ever blocks or takes a lock. Capacity must be
+	// a power of two
+	template <typename T, unsigned Capacity>
+	class SPSCQueue
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+			"SPSCQueue capacity must be a power of two");
+
+		static const size_t cacheLine = 64;
+
+		T slots[Capacity];
+
+		// indices only ever increase and wrap through the mask. they're
+		// padded a cache line apart so the two threads don't fight over
+		// them. padding rather than alignas keeps the queue at normal
+		// alignment, so a plain new of anything holding one is fine
+		char slotsPad[cacheLine];
+		std::atomic<unsigned> head; // next slot to read, written by the consumer
+		char headPad[cacheLine - sizeof(std::atomic<unsigned>)];
+		std::atomic<unsigned> tail; // next slot to write, written by the producer
+		char tailPad[cacheLine - sizeof(std::atomic<unsigned>)];
+	public:
+		SPSCQueue() : head(0), tail(0) { }
+
+		SPSCQueue(const SPSCQueue&) = delete;
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+		// producer only, false if the queue is full
+		template <typename U>
+		bool push(U&& item)
+		{
+			unsigned t = tail.load(std::memory_order_relaxed);
+			if (t - head.load(std::memory_order_acquire) == Capacity)
+				return false;
+			slots[t & (Capacity - 1)] = std::forward<U>(item);
+			tail.store(t + 1, std::memory_order_release);
+			return true;
+		}
+
+		// producer only, the slot to fill in place before commit, nullptr
+		// if the queue is full
+		T *reserve()
+		{
+			unsigned t = tail.load(std::memory_order_relaxed);
+			if (t - head.load(std::memory_order_acquire) == Capacity)
+				return nullptr;
+			return &slots[t & (Capacity - 1)];
+		}
+
+		void commit()
+		{
+			tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		// consumer only, the oldest item without copying it out, nullptr if
+		// the queue is empty. stays valid until release
+		const T *front()
+		{
+			unsigned h = head.load(std::memory_order_relaxed);
+			if (h == tail.load(std::memory_order_acquire))
+				return nullptr;
+			return &slots[h & (Capacity - 1)];
+		}
+
+		void release()
+		{
+			head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		// consumer only, false if the queue is empty
+		bool pop(T& item)
+		{
+			unsigned h = head.load(std::memory_order_relaxed);
+			if (h == tail.load(std::memory_order_acquire))
+				return false;
+			item = std::move(slots[h & (Capacity - 1)]);
+			head.store(h + 1, std::memory_order_release);
+			return true;
+		}
+
+		// only a snapshot when called from either side
+		unsigned size() const
+		{
+			return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+		}
+
+		static unsigned capacity() { return Capacity; }
+	};
+}
+
+#endif // SPSCQUEUE_H
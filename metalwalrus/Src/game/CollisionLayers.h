@@ -0,0 +1,23 @@
+#ifndef COLLISIONLAYERS_H
+#define COLLISIONLAYERS_H
+#pragma once
+
+namespace metalwalrus
+{
+	// layer bits for the game's solid objects, also used as trigger types
+	class CollisionLayers
+	{
+		CollisionLayers(); // static class
+	public:
+		static const unsigned PLAYER = 1 << 0;
+		static const unsigned ENEMY = 1 << 1;
+		static const unsigned PLAYER_BULLET = 1 << 2;
+		static const unsigned ENEMY_BULLET = 1 << 3;
+		static const unsigned PICKUP = 1 << 4;
+		static const unsigned LADDER = 1 << 5;
+		static const unsigned KILLBOX = 1 << 6;
+		static const unsigned LEVEL_FINISH = 1 << 7;
+	};
+}
+
+#endif // COLLISIONLAYERS_H
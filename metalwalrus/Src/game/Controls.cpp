@@ -0,0 +1,25 @@
+#include "Controls.h"
+
+namespace metalwalrus
+{
+	InputID Controls::LEFT = InputHandler::INVALID_INPUT;
+	InputID Controls::UP = InputHandler::INVALID_INPUT;
+	InputID Controls::DOWN = InputHandler::INVALID_INPUT;
+	InputID Controls::RIGHT = InputHandler::INVALID_INPUT;
+	InputID Controls::SHOOT = InputHandler::INVALID_INPUT;
+	InputID Controls::JUMP = InputHandler::INVALID_INPUT;
+	InputID Controls::ESCAPE = InputHandler::INVALID_INPUT;
+	InputID Controls::DEBUG = InputHandler::INVALID_INPUT;
+
+	void Controls::initialize()
+	{
+		LEFT = InputHandler::addInput("left", GLFW_KEY_LEFT);
+		UP = InputHandler::addInput("up", GLFW_KEY_UP);
+		DOWN = InputHandler::addInput("down", GLFW_KEY_DOWN);
+		RIGHT = InputHandler::addInput("right", GLFW_KEY_RIGHT);
+		SHOOT = InputHandler::addInput("shoot", GLFW_KEY_X);
+		JUMP = InputHandler::addInput("a", GLFW_KEY_Z);
+		ESCAPE = InputHandler::addInput("esc", GLFW_KEY_ESCAPE);
+		DEBUG = InputHandler::addInput("f5", GLFW_KEY_F5);
+	}
+}
@@ -0,0 +1,27 @@
+#ifndef CONTROLS_H
+#define CONTROLS_H
+#pragma once
+
+#include "../Framework/Input/InputHandler.h"
+
+namespace metalwalrus
+{
+	// input IDs for the game's actions, registered once on startup
+	class Controls
+	{
+		Controls(); // static class
+	public:
+		static InputID LEFT;
+		static InputID UP;
+		static InputID DOWN;
+		static InputID RIGHT;
+		static InputID SHOOT;
+		static InputID JUMP;
+		static InputID ESCAPE;
+		static InputID DEBUG;
+
+		static void initialize();
+	};
+}
+
+#endif // CONTROLS_H
@@ -4,7 +4,7 @@ namespace metalwalrus
 {
 	void BouncerBouncingState::enter(BouncingRobot& b)
 	{
-		b.get_animatedSprite().play("inAir");
+		b.get_animatedSprite().play(b.get_animations().inAir);
 		b.get_springExtended() = true;
 		b.jump();
 	}
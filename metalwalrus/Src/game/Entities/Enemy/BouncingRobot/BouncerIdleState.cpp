@@ -6,11 +6,11 @@ namespace metalwalrus
 	{
 		timer = b.get_timeOnGround();
 		if (b.get_springExtended())
-			b.get_animatedSprite().playOneShot("compress", [&b] { b.get_animatedSprite().play("idle"); });
+			b.get_animatedSprite().playOneShot(b.get_animations().compress, [&b] { b.get_animatedSprite().play(b.get_animations().idle); });
 		else 
 		{
 			timer = 0;
-			b.get_animatedSprite().play("idle");
+			b.get_animatedSprite().play(b.get_animations().idle);
 		}
 		b.get_springExtended() = false;
 	}
@@ -1,9 +1,13 @@
 #include "BouncingRobot.h"
 
+#include "../../../../Framework/Util/JSONUtil.h"
+
 namespace metalwalrus
 {
+	ObjectPool<BouncingRobot> BouncingRobot::pool("BouncingRobot", 32);
 	Texture2D *BouncingRobot::bouncerTex;
 	SpriteSheet *BouncingRobot::bouncerSheet;
+	AnimatedSprite *BouncingRobot::bouncerSprites[2];
 	
 	void BouncingRobot::start()
 	{
@@ -13,36 +17,34 @@ namespace metalwalrus
 			bouncerSheet = new SpriteSheet(bouncerTex, 16, 16);
 
 		int sheetAddition = this->hardEnemy ? 8 : 0;
-		this->sprite = new AnimatedSprite(bouncerSheet);
-		this->sprite->addAnimation("idle", FrameAnimation(0, sheetAddition + 2, 0));
-		this->sprite->addAnimation("compress", FrameAnimation(3, sheetAddition, 0.2F));
-		this->sprite->addAnimation("inAir", FrameAnimation(2, sheetAddition + 3, 0.1F));
+		AnimatedSprite *&clips = bouncerSprites[this->hardEnemy ? 1 : 0];
+		if (clips == nullptr)
+			clips = utilities::JSONUtil::animated_sprite("assets/data/sprite/bouncing-robot.json",
+				bouncerSheet, sheetAddition);
+
+		this->sprite = new AnimatedSprite(*clips);
+		this->animations.idle = sprite->get_animationID("idle");
+		this->animations.compress = sprite->get_animationID("compress");
+		this->animations.inAir = sprite->get_animationID("inAir");
 
 		this->machine.transition(new BouncerIdleState("idle", &machine), *this);
 	}
 
-	void BouncingRobot::update(double delta)
+	void BouncingRobot::prepare(double delta)
 	{
 		this->velocity.y -= GameScene::gravity;
 		if (this->velocity.y < GameScene::terminalVelocity)
 			this->velocity.y = GameScene::terminalVelocity;
 
-		oldPosition = position;
-		this->moveBy(Vector2(this->velocity.x * delta, 0));
-		AABB bb;
-		Tile t;
-		if (GameScene::loadedMap->boundingBoxCollides(boundingBox, bb, t))
-		{
-			this->moveTo(oldPosition);
-		}
+		GameScene::loadedMap->sweepX(boundingBox, this->velocity.x * delta, tileSweep);
+		this->step = Vector2(tileSweep.distance, 0);
 
-		oldPosition = position;
-		this->moveBy(Vector2(0, this->velocity.y * delta));
-		if (GameScene::loadedMap->boundingBoxCollides(boundingBox, bb, t))
+		GameScene::loadedMap->sweepY(boundingBox + this->step, this->velocity.y * delta, tileSweep);
+		this->step.y = tileSweep.distance;
+		if (tileSweep.hit)
 		{
 			this->velocity.y = 0;
-			this->moveTo(oldPosition);
-			if (this->position.y > bb.get_top())
+			if (tileSweep.normal.y > 0)
 			{
 				this->onGround = true;
 				this->velocity.x = 0;
@@ -55,29 +57,38 @@ namespace metalwalrus
 
 		this->sprite->update(delta);
 
+		this->playerNear = false;
+		Player *p = this->get_player();
 		if (p == nullptr)
-			p = (Player*)this->parentScene->getWithID(GameScene::playerID);
+			return;
 
-		Vector2 toPlayer = (p->get_center() - this->position);
-		float distance = toPlayer.dist();
+		Vector2 toPlayer = (p->get_center() - (this->position + this->step));
+		this->playerNear = toPlayer.dist() <= 120;
+	}
 
-		if (distance > 120)
-			return;
+	void BouncingRobot::update(double delta)
+	{
+		this->moveBy(this->step);
 
-		this->machine.update(delta, *this);
+		if (this->playerNear)
+			this->machine.update(delta, *this);
 	}
 
 	void BouncingRobot::draw(SpriteBatch& batch)
 	{
+		Vector2 drawPos = get_drawPosition();
 		TextureRegion *kf = this->sprite->get_keyframe();
+		if (kf == nullptr)
+			return;
 		kf->set_flipX(this->facingLeft);
-		batch.drawreg(*kf, this->position.x, this->position.y);
+		batch.drawreg(*kf, drawPos.x, drawPos.y);
 	}
 
 	void BouncingRobot::jump()
 	{
+		Player *p = this->get_player();
 		if (p == nullptr)
-			p = (Player*)this->parentScene->getWithID(GameScene::playerID);
+			return;
 
 		Vector2 toPlayer = this->position - p->get_position();
 		bool playerOnLeft = toPlayer.dot(Vector2::RIGHT) < 0;
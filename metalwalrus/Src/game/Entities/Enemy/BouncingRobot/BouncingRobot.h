@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../Enemy.h"
+#include "../../../../Framework/Game/ObjectPool.h"
 
 #include "../../../../Framework/State/PushDownStateMachine.h"
 
@@ -10,21 +11,35 @@ namespace metalwalrus
 {
 	class BouncingRobot : public Enemy
 	{
+	public:
+		struct Animations
+		{
+			AnimationID idle;
+			AnimationID compress;
+			AnimationID inAir;
+		};
+
 	protected:
 		float jumpVelocity; // velocity in y
 		float leapVelocity; // velocity in x
 		float timeOnGround;
 		static Texture2D *bouncerTex;
 		static SpriteSheet *bouncerSheet;
+		static AnimatedSprite *bouncerSprites[2]; // clip tables for normal and hard variants
 		AnimatedSprite *sprite;
+		Animations animations;
 		bool onGround;
 		bool springExtended;
 		Vector2 velocity;
-		Vector2 oldPosition;
+		TileSweep tileSweep;
+		Vector2 step; // worked out in prepare, applied in update
+		bool playerNear;
 
 		PushDownStateMachine<BouncingRobot> machine;
 
 	public:
+		static ObjectPool<BouncingRobot> pool;
+
 		BouncingRobot(Vector2 pos, bool isHard, bool facingLeft)
 			: Enemy(pos, 16, 16, Vector2::ZERO, isHard, facingLeft,
 				isHard ? 4 : 2,
@@ -35,17 +50,21 @@ namespace metalwalrus
 			, timeOnGround(isHard ? 1.0 : 2.0)
 			, onGround(true)
 			, springExtended(false)
-			, velocity(Vector2::ZERO) { }
+			, velocity(Vector2::ZERO)
+			, step(Vector2::ZERO)
+			, playerNear(false) { }
 		~BouncingRobot()
 		{
 			delete sprite;
 		}
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 
 		AnimatedSprite& get_animatedSprite() const { return *sprite; }
+		const Animations& get_animations() const { return animations; }
 		bool& get_onGround() { return this->onGround; }
 		bool& get_springExtended() { return this->springExtended; }
 		float get_timeOnGround() const { return this->timeOnGround; }
@@ -3,28 +3,37 @@
 #include <cstdlib>
 #include <ctime>
 #include "../../../Framework/Audio/AudioLocator.h"
+#include "../../CollisionLayers.h"
+#include "../../Sounds.h"
 
 namespace metalwalrus
 {
+	const TagID Enemy::TAG = Tag::intern("enemy");
+
 	Enemy::Enemy(Vector2 position, unsigned width, unsigned height, Vector2 offset, bool isHard, bool facingLeft, int health, int damage, int score)
-		: SolidObject(position, width, height, offset, "enemy"), health(health), damage(damage), facingLeft(facingLeft)
-		, p(nullptr), score(score), hardEnemy(isHard)
+		: SolidObject(position, width, height, offset, Enemy::TAG), health(health), damage(damage), facingLeft(facingLeft)
+		, score(score), hardEnemy(isHard)
 	{
-		srand(time(nullptr));
+		this->set_collisionLayer(CollisionLayers::ENEMY,
+			CollisionLayers::PLAYER | CollisionLayers::PLAYER_BULLET);
 		this->healthSpawnChance = 10;
 		this->healthBigChance = 10;
 	}
 
-	void Enemy::die()
+	Player *Enemy::get_player()
 	{
-		if (p == nullptr)
-			p = ((Player*)this->parentScene->getWithID(GameScene::playerID));
+		return (Player*)this->parentScene->getWithID(GameScene::playerID);
+	}
 
-		p->add_score(this->score);
+	void Enemy::die()
+	{
+		Player *p = this->get_player();
+		if (p != nullptr)
+			p->add_score(this->score);
 
 		if ((rand() % 100) + 1 < healthSpawnChance)
 		{
-			this->parentScene->registerObject(new HealthPowerup(this->position, 
+			this->parentScene->registerObject(HealthPowerup::pool.create(this->position, 
 				(rand() % 100) + 1 >= healthBigChance, 
 				picojson::value()));
 		}
@@ -35,14 +44,15 @@ namespace metalwalrus
 	void Enemy::takeDamage(int damageAmount)
 	{
 		health -= damageAmount;
-		AudioLocator::getAudio().playSound("assets/snd/sfx/enemy_hurt.wav");
+		AudioLocator::getAudio().playSound(Sounds::ENEMY_HURT, GameScene::screenPan(get_center()));
 		if (health <= 0) this->die();
 	}
 
 	void Enemy::damagePlayer()
 	{
+		Player *p = this->get_player();
 		if (p == nullptr)
-			p = ((Player*)this->parentScene->getWithID(GameScene::playerID));
+			return;
 
 		if (this->boundingBox.intersects(p->get_boundingBox()))
 			p->takeDamage(this->damage, this);
@@ -21,12 +21,15 @@ namespace metalwalrus
 		int score; // score on kill
 		bool facingLeft;
 		bool hardEnemy;
-		Player *p;
 
 		int healthSpawnChance; // chance of health spawn on kill (out of 100)
 		int healthBigChance; // chance of big health spawn on health spawn
 
+		Player *get_player(); // nullptr if the player has been destroyed
+
 	public:
+		static const TagID TAG;
+
 		Enemy(Vector2 position, unsigned width, unsigned height, Vector2 offset,
 			bool isHard, bool facingLeft, int health, int damage, int score);
 		virtual ~Enemy() { }
@@ -1,14 +1,17 @@
 #include "EnemyBullet.h"
 
 #include "../../Scenes/GameScene.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
+	ObjectPool<EnemyBullet> EnemyBullet::pool("EnemyBullet", 64);
 	Texture2D *EnemyBullet::bulletTex;
 	
 	EnemyBullet::EnemyBullet(Vector2 pos, Vector2 bulletVelocity, int damage)
-		: SolidObject(pos, 8, 6, Vector2::ZERO), bulletVelocity(bulletVelocity), timer(0), damage(damage), p(nullptr)
+		: SolidObject(pos, 8, 6, Vector2::ZERO), bulletVelocity(bulletVelocity), timer(0), damage(damage)
 	{
+		this->set_collisionLayer(CollisionLayers::ENEMY_BULLET, CollisionLayers::PLAYER);
 	}
 	
 	void EnemyBullet::start()
@@ -17,23 +20,24 @@ namespace metalwalrus
 			bulletTex = Texture2D::create("assets/sprite/bullet-enemy.png");
 	}
 
-	void EnemyBullet::update(double delta)
+	void EnemyBullet::prepare(double delta)
 	{
-		if (!p)
-		{
-			p = (Player*)this->parentScene->getWithID(GameScene::playerID);
-		}
-		
 		timer += delta;
+		step = bulletVelocity * delta;
+	}
+
+	void EnemyBullet::update(double delta)
+	{
 		if (timer > lifeTime)
 		{
 			this->parentScene->destroyObject(this);
 			return;
 		}
 
-		this->moveBy(bulletVelocity * delta);
+		this->moveBy(step);
 
-		if (this->boundingBox.intersects(p->get_boundingBox()))
+		Player *p = (Player*)this->parentScene->getWithID(GameScene::playerID);
+		if (p != nullptr && this->boundingBox.intersects(p->get_boundingBox()))
 		{
 			p->takeDamage(damage, this);
 			this->parentScene->destroyObject(this);
@@ -42,6 +46,7 @@ namespace metalwalrus
 
 	void EnemyBullet::draw(SpriteBatch& batch)
 	{
-		batch.drawtex(*bulletTex, position.x, position.y);
+		Vector2 drawPos = get_drawPosition();
+		batch.drawtex(*bulletTex, drawPos.x, drawPos.y);
 	}
 }
\ No newline at end of file
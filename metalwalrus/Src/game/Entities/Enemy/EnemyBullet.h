@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../../../Framework/Game/SolidObject.h"
+#include "../../../Framework/Game/ObjectPool.h"
 #include "../../Entities/Player/Player.h"
 
 namespace metalwalrus
@@ -13,14 +14,17 @@ namespace metalwalrus
 		const float lifeTime = 5.0;
 
 		int damage;
+		Vector2 step; // worked out in prepare, applied in update
 
 		const Vector2 bulletVelocity;
 		static Texture2D *bulletTex;
-		Player *p = nullptr;
 	public:
+		static ObjectPool<EnemyBullet> pool;
+
 		EnemyBullet(Vector2 pos, Vector2 bulletVelocity, int damage);
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 	};
@@ -1,13 +1,16 @@
 #include "FloaterEnemy.h"
 
 #include "../../../Scenes/GameScene.h"
+#include "../../../../Framework/Util/JSONUtil.h"
 
 #include <GLFW/glfw3.h>
 
 namespace metalwalrus
 {
+	ObjectPool<FloaterEnemy> FloaterEnemy::pool("FloaterEnemy", 32);
 	Texture2D *FloaterEnemy::floaterTex;
 	SpriteSheet *FloaterEnemy::floaterSheet;
+	AnimatedSprite *FloaterEnemy::floaterSprites[2];
 	
 	void FloaterEnemy::start()
 	{
@@ -16,16 +19,24 @@ namespace metalwalrus
 		if (floaterSheet == nullptr)
 			floaterSheet = new SpriteSheet(floaterTex, 16, 16);
 
-		this->sprite = new AnimatedSprite(floaterSheet);
-		this->sprite->addAnimation("main", FrameAnimation(6, this->hardEnemy ? 8 : 0, 0.2F));
-		this->sprite->play("main");
+		AnimatedSprite *&clips = floaterSprites[this->hardEnemy ? 1 : 0];
+		if (clips == nullptr)
+			clips = utilities::JSONUtil::animated_sprite("assets/data/sprite/floater.json",
+				floaterSheet, this->hardEnemy ? 8 : 0);
+
+		this->sprite = new AnimatedSprite(*clips);
+		this->sprite->play(sprite->get_animationID("main"));
 	}
 
-	void FloaterEnemy::update(double delta)
+	void FloaterEnemy::prepare(double delta)
 	{
 		this->sprite->update(delta);
+		this->step = Vector2::ZERO;
 		
-		GameObject *player = this->parentScene->getWithID(GameScene::playerID);
+		Player *player = this->get_player();
+		if (player == nullptr)
+			return;
+
 		Vector2 toPlayer = (player->get_center() - this->position);
 		float distance = toPlayer.dist();
 
@@ -34,16 +45,23 @@ namespace metalwalrus
 
 		if (distance > 8)
 		{
-			toPlayer = toPlayer.normalize() * this->speed;
-			this->moveBy(toPlayer);
+			this->step = toPlayer.normalize() * this->speed;
 		}
 	}
 
+	void FloaterEnemy::update(double delta)
+	{
+		this->moveBy(this->step);
+	}
+
 	void FloaterEnemy::draw(SpriteBatch& batch)
 	{
+		Vector2 drawPos = get_drawPosition();
 		TextureRegion *kf = this->sprite->get_keyframe();
+		if (kf == nullptr)
+			return;
 		kf->set_flipX(this->facingLeft);
-		batch.drawreg(*kf, this->position.x, this->position.y);
+		batch.drawreg(*kf, drawPos.x, drawPos.y);
 	}
 
 }
\ No newline at end of file
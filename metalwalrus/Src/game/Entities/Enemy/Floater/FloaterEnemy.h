@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../Enemy.h"
+#include "../../../../Framework/Game/ObjectPool.h"
 
 #include "../../../../Framework/Animation/AnimatedSprite.h"
 
@@ -15,21 +16,26 @@ namespace metalwalrus
 		float speed; // speed to move towards the player
 		static Texture2D *floaterTex;
 		static SpriteSheet *floaterSheet;
+		static AnimatedSprite *floaterSprites[2]; // clip tables for normal and hard variants
 		AnimatedSprite *sprite;
+		Vector2 step; // worked out in prepare, applied in update
 
 	public:
+		static ObjectPool<FloaterEnemy> pool;
+
 		FloaterEnemy(Vector2 pos, bool isHard, bool facingLeft)
 			: Enemy(pos, 16, 16, Vector2::ZERO, isHard, facingLeft,
 				isHard ? 2 : 1, 
 				isHard ? 6 : 3, 
 				isHard ? 400 : 100)
-			, speed(isHard ? 0.6F : 0.4F) { }
+			, speed(isHard ? 0.6F : 0.4F), step(Vector2::ZERO) { }
 		~FloaterEnemy()
 		{
 			delete sprite;
 		}
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 	};
@@ -4,7 +4,7 @@ namespace metalwalrus
 {
 	void RobotIdleState::enter(RobotShooter& r)
 	{
-		r.get_animatedSprite().play("idle");
+		r.get_animatedSprite().play(r.get_animations().idle);
 	}
 
 	void RobotIdleState::update(double delta, RobotShooter& r)
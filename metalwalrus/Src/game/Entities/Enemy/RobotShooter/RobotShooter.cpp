@@ -1,10 +1,13 @@
 #include "RobotShooter.h"
 #include "../EnemyBullet.h"
+#include "../../../../Framework/Util/JSONUtil.h"
 
 namespace metalwalrus
 {
+	ObjectPool<RobotShooter> RobotShooter::pool("RobotShooter", 32);
 	Texture2D *RobotShooter::robotTex;
 	SpriteSheet *RobotShooter::robotSheet;
+	AnimatedSprite *RobotShooter::robotSprites[2];
 	
 	void RobotShooter::start()
 	{
@@ -14,32 +17,44 @@ namespace metalwalrus
 			robotSheet = new SpriteSheet(robotTex, 32, 32);
 
 		int sheetAddition = this->hardEnemy ? 8 : 0;
-		sprite = new AnimatedSprite(robotSheet);
-		sprite->addAnimation("idle", FrameAnimation(4, sheetAddition + 1, 0.2F));
-		sprite->addAnimation("shoot", FrameAnimation(0, sheetAddition, 0));
+		AnimatedSprite *&clips = robotSprites[this->hardEnemy ? 1 : 0];
+		if (clips == nullptr)
+			clips = utilities::JSONUtil::animated_sprite("assets/data/sprite/robot-shooter.json",
+				robotSheet, sheetAddition);
+
+		sprite = new AnimatedSprite(*clips);
+		animations.idle = sprite->get_animationID("idle");
+		animations.shoot = sprite->get_animationID("shoot");
 
 		machine.transition(new RobotIdleState("idle", &machine), *this);
 	}
 
+	void RobotShooter::prepare(double delta)
+	{
+		sprite->update(delta);
+	}
+
 	void RobotShooter::update(double delta)
 	{
 		machine.update(delta, *this);
-
-		sprite->update(delta);
 	}
 
 	void RobotShooter::draw(SpriteBatch& batch)
 	{
+		Vector2 drawPos = get_drawPosition();
 		TextureRegion *kf = this->sprite->get_keyframe();
+		if (kf == nullptr)
+			return;
 		kf->set_flipX(this->facingLeft);
-		batch.drawreg(*kf, this->position.x, this->position.y);
+		batch.drawreg(*kf, drawPos.x, drawPos.y);
 	}
 
 	bool RobotShooter::get_playerSensed()
 	{
+		Player *p = this->get_player();
 		if (p == nullptr)
-			p = (Player*)this->parentScene->getWithID(GameScene::playerID);
-		
+			return false;
+
 		Vector2 toPlayer = (p->get_center() - this->position);
 		float distance = toPlayer.dist();
 
@@ -61,6 +76,6 @@ namespace metalwalrus
 	void RobotShooter::shoot()
 	{
 		Vector2 bulletVel = Vector2(facingLeft ? -bulletSpeed : bulletSpeed, 0);
-		this->parentScene->registerObject(new EnemyBullet(this->get_center(), bulletVel, this->damage));
+		this->parentScene->registerObject(EnemyBullet::pool.create(this->get_center(), bulletVel, this->damage));
 	}
 }
@@ -2,15 +2,26 @@
 #define ROBOTSHOOTER_H
 #pragma once
 #include "../Enemy.h"
+#include "../../../../Framework/Game/ObjectPool.h"
 
 namespace metalwalrus
 {
 	class RobotShooter : public Enemy
 	{
+	public:
+		struct Animations
+		{
+			AnimationID idle;
+			AnimationID shoot;
+		};
+
+	private:
 		static Texture2D *robotTex;
 		static SpriteSheet *robotSheet;
+		static AnimatedSprite *robotSprites[2]; // clip tables for normal and hard variants
 		const static int SENSE_DISTANCE = 140;
 		AnimatedSprite *sprite;
+		Animations animations;
 		
 		float timeBetweenShots;
 		float shotCooldown;
@@ -20,6 +31,8 @@ namespace metalwalrus
 		PushDownStateMachine<RobotShooter> machine;
 
 	public:
+		static ObjectPool<RobotShooter> pool;
+
 		RobotShooter(Vector2 pos, bool isHard, bool facingLeft)
 			: Enemy(pos, 15, 30, Vector2(6, 0), isHard, facingLeft,
 				isHard ? 6 : 4,
@@ -35,10 +48,12 @@ namespace metalwalrus
 		}
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 
 		AnimatedSprite& get_animatedSprite() const { return *sprite; }
+		const Animations& get_animations() const { return animations; }
 		float get_timeBetweenShots() const { return timeBetweenShots; }
 		float get_shotCooldown() const { return shotCooldown; }
 		bool get_playerSensed();
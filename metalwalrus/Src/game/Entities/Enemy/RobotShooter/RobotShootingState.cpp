@@ -8,7 +8,7 @@ namespace metalwalrus
 		timeBetweenShotsTimer = 0;
 		shotCount = 0;
 
-		r.get_animatedSprite().play("shoot");
+		r.get_animatedSprite().play(r.get_animations().shoot);
 	}
 
 	void RobotShootingState::update(double delta, RobotShooter& r)
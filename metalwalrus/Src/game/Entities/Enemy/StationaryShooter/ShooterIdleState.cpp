@@ -6,9 +6,9 @@ namespace metalwalrus
 	{
 		frameTimer = s.get_shotCooldownFrames();
 		if (s.get_isOpen())
-			s.get_animatedSprite().playOneShot("close", [&s] {s.get_animatedSprite().play("idle");});
+			s.get_animatedSprite().playOneShot(s.get_animations().close, [&s] {s.get_animatedSprite().play(s.get_animations().idle);});
 		else 
-			s.get_animatedSprite().play("idle");
+			s.get_animatedSprite().play(s.get_animations().idle);
 		s.get_isOpen() = false;
 	}
 	
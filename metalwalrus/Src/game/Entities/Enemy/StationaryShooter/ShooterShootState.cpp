@@ -6,12 +6,12 @@ namespace metalwalrus
 	{
 		frameTimer = s.get_shotCooldownFrames();
 		if (!s.get_isOpen())
-			s.get_animatedSprite().playOneShot("open", [&s] {
-				s.get_animatedSprite().play("shoot");
+			s.get_animatedSprite().playOneShot(s.get_animations().open, [&s] {
+				s.get_animatedSprite().play(s.get_animations().shoot);
 				s.shoot();
 			});
 		else
-			s.get_animatedSprite().play("shoot");
+			s.get_animatedSprite().play(s.get_animations().shoot);
 		s.get_isOpen() = true;
 	}
 
@@ -1,18 +1,17 @@
 #include "StationaryShooter.h"
 #include "../EnemyBullet.h"
+#include "../../../../Framework/Util/JSONUtil.h"
 
 namespace metalwalrus
 {
+	ObjectPool<StationaryShooter> StationaryShooter::pool("StationaryShooter", 32);
 	Texture2D *StationaryShooter::shooterTex;
 	SpriteSheet *StationaryShooter::shooterSheet;
+	AnimatedSprite *StationaryShooter::shooterSprites[2];
 	
 	void StationaryShooter::shoot()
 	{
-		shootingUp = !shootingUp;
-
-		Vector2 bulletVel = Vector2(facingLeft ? -bulletSpeed : bulletSpeed,
-			shootingUp ? bulletSpeed : -bulletSpeed);
-		parentScene->registerObject(new EnemyBullet(this->get_center(), bulletVel, this->damage));
+		shotsPending++;
 	}
 
 	void StationaryShooter::start()
@@ -23,35 +22,55 @@ namespace metalwalrus
 			shooterSheet = new SpriteSheet(shooterTex, 16, 16);
 
 		int sheetAddition = this->hardEnemy ? 8 : 0;
-		this->sprite = new AnimatedSprite(shooterSheet);
-		this->sprite->addAnimation("idle", FrameAnimation(0, sheetAddition, 0));
-		this->sprite->addAnimation("open", FrameAnimation(4, sheetAddition, 0.1));
-		this->sprite->addAnimation("close", FrameAnimation(4, sheetAddition + 3, 0.1));
-		this->sprite->addAnimation("shoot", FrameAnimation(0, sheetAddition + 3, 0));
+		AnimatedSprite *&clips = shooterSprites[this->hardEnemy ? 1 : 0];
+		if (clips == nullptr)
+			clips = utilities::JSONUtil::animated_sprite("assets/data/sprite/stationary-shooter.json",
+				shooterSheet, sheetAddition);
+
+		this->sprite = new AnimatedSprite(*clips);
+		this->animations.idle = sprite->get_animationID("idle");
+		this->animations.open = sprite->get_animationID("open");
+		this->animations.close = sprite->get_animationID("close");
+		this->animations.shoot = sprite->get_animationID("shoot");
 		
 		machine.transition(new ShooterIdleState("idle", &machine), *this);
 	}
 
-	void StationaryShooter::update(double delta)
+	void StationaryShooter::prepare(double delta)
 	{
 		this->sprite->update(delta);
 		
+		this->playerNear = false;
+		Player *p = this->get_player();
 		if (p == nullptr)
-			p = (Player*)this->parentScene->getWithID(GameScene::playerID);
+			return;
 
 		Vector2 toPlayer = (p->get_center() - this->position);
-		float distance = toPlayer.dist();
+		this->playerNear = toPlayer.dist() <= 150;
+	}
 
-		if (distance > 150)
-			return;
+	void StationaryShooter::update(double delta)
+	{
+		for (; shotsPending > 0; shotsPending--)
+		{
+			shootingUp = !shootingUp;
 
-		machine.update(delta, *this);
+			Vector2 bulletVel = Vector2(facingLeft ? -bulletSpeed : bulletSpeed,
+				shootingUp ? bulletSpeed : -bulletSpeed);
+			parentScene->registerObject(EnemyBullet::pool.create(this->get_center(), bulletVel, this->damage));
+		}
+
+		if (this->playerNear)
+			machine.update(delta, *this);
 	}
 
 	void StationaryShooter::draw(SpriteBatch& batch)
 	{
+		Vector2 drawPos = get_drawPosition();
 		TextureRegion *kf = this->sprite->get_keyframe();
+		if (kf == nullptr)
+			return;
 		kf->set_flipX(this->facingLeft);
-		batch.drawreg(*kf, this->position.x, this->position.y);
+		batch.drawreg(*kf, drawPos.x, drawPos.y);
 	}
 }
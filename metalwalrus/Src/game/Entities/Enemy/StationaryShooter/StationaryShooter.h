@@ -3,24 +3,40 @@
 #pragma once
 
 #include "../Enemy.h"
+#include "../../../../Framework/Game/ObjectPool.h"
 #include "../Src/Framework/Animation/FrameAnimation.h"
 
 namespace metalwalrus
 {
 	class StationaryShooter : public Enemy
 	{
+	public:
+		struct Animations
+		{
+			AnimationID idle;
+			AnimationID open;
+			AnimationID close;
+			AnimationID shoot;
+		};
+
 	protected:
 		int shotCooldownFrames;
 		int bulletSpeed = 10;
 		static Texture2D *shooterTex;
 		static SpriteSheet *shooterSheet;
+		static AnimatedSprite *shooterSprites[2]; // clip tables for normal and hard variants
 		AnimatedSprite *sprite;
+		Animations animations;
 		bool shooting;
 		bool shootingUp;
 		bool open;
+		int shotsPending; // shoot is called from animation callbacks, bullets are spawned in update
+		bool playerNear;
 
 		PushDownStateMachine<StationaryShooter> machine;
 	public:
+		static ObjectPool<StationaryShooter> pool;
+
 		StationaryShooter(Vector2 pos, bool isHard, bool facingLeft)
 			: Enemy(pos, 16, 16, Vector2::ZERO, isHard, facingLeft,
 				isHard ? 4 : 2,
@@ -31,6 +47,8 @@ namespace metalwalrus
 			, shootingUp(false)
 			, sprite(nullptr)
 			, open(false)
+			, shotsPending(0)
+			, playerNear(false)
 			, bulletSpeed(100) { }
 		~StationaryShooter()
 		{
@@ -38,12 +56,14 @@ namespace metalwalrus
 		}
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 
 		void shoot();
 
 		AnimatedSprite& get_animatedSprite() const { return *sprite; }
+		const Animations& get_animations() const { return animations; }
 		bool& get_shooting() { return shooting; }
 		bool& get_shootingUp() { return shootingUp; }
 		int get_shotCooldownFrames() const { return shotCooldownFrames; }
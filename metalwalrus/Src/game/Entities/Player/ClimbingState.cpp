@@ -4,7 +4,7 @@ namespace metalwalrus
 {
 	void ClimbingState::enter(Player& p)
 	{
-		p.get_animatedSprite()->play("climbing");
+		p.get_animatedSprite()->play(p.get_animations().climbing);
 	}
 
 	void ClimbingState::update(double delta, Player& p)
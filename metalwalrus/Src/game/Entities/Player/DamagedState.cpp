@@ -4,7 +4,7 @@ namespace metalwalrus
 {
 	void DamagedState::enter(Player& p)
 	{
-		p.get_animatedSprite()->play("damaged");
+		p.get_animatedSprite()->play(p.get_animations().damaged);
 		frameTimer = Player::damageAnimationFrames;
 		p.get_playerInfo().jumping = false;
 		p.get_playerInfo().canJump = false;
@@ -4,7 +4,7 @@ namespace metalwalrus
 {
 	void IdleState::enter(Player& p)
 	{
-		p.get_animatedSprite()->play("idle");
+		p.get_animatedSprite()->play(p.get_animations().idle);
 		p.get_playerInfo().canJump = true;
 	}
 
@@ -5,7 +5,7 @@ namespace metalwalrus
 {
 	void InAirState::enter(Player& p)
 	{
-		p.get_animatedSprite()->play("jump");
+		p.get_animatedSprite()->play(p.get_animations().jump);
 		p.get_playerInfo().canJump = false;
 	}
 
@@ -3,10 +3,13 @@
 #include "../../../Framework/Graphics/Texture2D.h"
 #include "../../../Framework/Input/InputHandler.h"
 #include "../../../Framework/Audio/AudioLocator.h"
+#include "../../../Framework/Util/JSONUtil.h"
 
 #include "States.h"
 #include "PlayerBullet.h"
 #include "../../Scenes/GameScene.h"
+#include "../../Controls.h"
+#include "../../Sounds.h"
 
 namespace metalwalrus
 {
@@ -33,13 +36,17 @@ namespace metalwalrus
 
 	int Player::score = 0;
 
+	Texture2D *Player::walrusTex;
+	SpriteSheet *Player::walrusSheet;
+	AnimatedSprite *Player::walrusClips;
+	Texture2D *Player::bulletTex;
+
 	Ladder *Player::checkCanClimb()
 	{
-		for (Ladder *l : GameScene::ladders)
-		{
-			if (this->boundingBox.intersects(l->get_boundingBox()))
-				return l;
-		}
+		contacts.clear();
+		GameScene::triggers.query(boundingBox, CollisionLayers::LADDER, contacts);
+		if (contacts.size() > 0)
+			return (Ladder*)contacts[0];
 		if (!playerInfo.climbing)
 		{
 			playerInfo.canClimb = true;
@@ -49,17 +56,17 @@ namespace metalwalrus
 
 	void Player::shoot()
 	{
-		parentScene->registerObject(new PlayerBullet(position + Vector2(playerInfo.facingLeft ? 0 : 26, 11), 
+		parentScene->registerObject(PlayerBullet::pool.create(position + Vector2(playerInfo.facingLeft ? 0 : 26, 11), 
 			playerInfo.facingLeft, bulletTex));
-		AudioLocator::getAudio().playSound("assets/snd/sfx/shoot.wav");
+		AudioLocator::getAudio().playSound(Sounds::SHOOT);
 	}
 
 	void Player::die()
 	{
 		playerInfo.alive = false;
-		walrusSprite->play("dead");
+		walrusSprite->play(animations.dead);
 		deathFrameTimer = framesAfterDeath;
-		AudioLocator::getAudio().playSound("assets/snd/sfx/player_death.wav");
+		AudioLocator::getAudio().playSound(Sounds::PLAYER_DEATH);
 	}
 
 	void Player::handleInput()
@@ -70,7 +77,7 @@ namespace metalwalrus
 		// climbing
 		if (Ladder *l = checkCanClimb())
 		{
-			if (InputHandler::checkButton("up", ButtonState::DOWN) 
+			if (InputHandler::checkButton(Controls::UP, ButtonState::DOWN) 
 				&& this->boundingBox.get_bottom() < l->get_boundingBox().get_top())
 			{
 				playerInfo.climbing = true;
@@ -80,7 +87,7 @@ namespace metalwalrus
 				this->velocity.x = 0;
 			}
 
-			if (InputHandler::checkButton("down", ButtonState::DOWN)
+			if (InputHandler::checkButton(Controls::DOWN, ButtonState::DOWN)
 				&& this->boundingBox.get_bottom() >= l->get_boundingBox().get_top())
 			{
 				playerInfo.climbing = true;
@@ -99,33 +106,33 @@ namespace metalwalrus
 
 		if (playerInfo.climbing)
 		{
-			if (InputHandler::checkButton("up", ButtonState::HELD))
+			if (InputHandler::checkButton(Controls::UP, ButtonState::HELD))
 			{
 				velocity.y = climbSpeed;
 				playerInfo.moving = true;
 			}
-			else if (InputHandler::checkButton("down", ButtonState::HELD))
+			else if (InputHandler::checkButton(Controls::DOWN, ButtonState::HELD))
 			{
 				velocity.y = -climbSpeed;
 				playerInfo.moving = true;
 			}
-			else if (InputHandler::checkButton("up", ButtonState::IDLE)
-				&& InputHandler::checkButton("down", ButtonState::IDLE))
+			else if (InputHandler::checkButton(Controls::UP, ButtonState::IDLE)
+				&& InputHandler::checkButton(Controls::DOWN, ButtonState::IDLE))
 			{
 				velocity.y = 0;
 				playerInfo.moving = false;
 			}
 
-			if (InputHandler::checkButton("left", ButtonState::DOWN))
+			if (InputHandler::checkButton(Controls::LEFT, ButtonState::DOWN))
 			{
 				playerInfo.facingLeft = true;
 			}
-			else if (InputHandler::checkButton("right", ButtonState::DOWN))
+			else if (InputHandler::checkButton(Controls::RIGHT, ButtonState::DOWN))
 			{
 				playerInfo.facingLeft = false;
 			}
 
-			if (InputHandler::checkButton("a", ButtonState::DOWN))
+			if (InputHandler::checkButton(Controls::JUMP, ButtonState::DOWN))
 			{
 				playerInfo.climbing = false;
 			}
@@ -134,7 +141,7 @@ namespace metalwalrus
 		// shooting
 		if (playerInfo.canShoot)
 		{
-			if (InputHandler::checkButton("shoot", ButtonState::DOWN))
+			if (InputHandler::checkButton(Controls::SHOOT, ButtonState::DOWN))
 			{
 				playerInfo.shooting = true;
 				playerInfo.canShoot = false;
@@ -146,7 +153,7 @@ namespace metalwalrus
 		if (playerInfo.climbing)
 			return;
 
-		if (InputHandler::checkButton("left", ButtonState::HELD))
+		if (InputHandler::checkButton(Controls::LEFT, ButtonState::HELD))
 		{
 			velocity.x = -walkSpeed;
 			playerInfo.facingLeft = true;
@@ -154,15 +161,15 @@ namespace metalwalrus
 		}
 
 		// left and right movement
-		if (InputHandler::checkButton("right", ButtonState::HELD))
+		if (InputHandler::checkButton(Controls::RIGHT, ButtonState::HELD))
 		{
 			velocity.x = walkSpeed;
 			playerInfo.facingLeft = false;
 			playerInfo.moving = true;
 		}
 
-		if (InputHandler::checkButton("left", ButtonState::IDLE)
-			&& InputHandler::checkButton("right", ButtonState::IDLE))
+		if (InputHandler::checkButton(Controls::LEFT, ButtonState::IDLE)
+			&& InputHandler::checkButton(Controls::RIGHT, ButtonState::IDLE))
 		{
 			velocity.x = 0;
 			playerInfo.moving = false;
@@ -171,7 +178,7 @@ namespace metalwalrus
 		// jumping
 		if (playerInfo.canJump)
 		{
-			if (InputHandler::checkButton("up", ButtonState::DOWN))
+			if (InputHandler::checkButton(Controls::UP, ButtonState::DOWN))
 			{
 				velocity.y = jumpSpeed;
 				playerInfo.jumping = true;
@@ -182,11 +189,11 @@ namespace metalwalrus
 		}
 		if (jumpFrameTimer > 0)
 		{
-			if (InputHandler::checkButton("up", ButtonState::UP))
+			if (InputHandler::checkButton(Controls::UP, ButtonState::UP))
 			{
 				jumpFrameTimer = 0;
 			}
-			if (InputHandler::checkButton("up", ButtonState::HELD))
+			if (InputHandler::checkButton(Controls::UP, ButtonState::HELD))
 			{
 				velocity.y = jumpSpeed;
 				jumpFrameTimer--;
@@ -200,39 +207,33 @@ namespace metalwalrus
 
 	Player::~Player()
 	{
-		delete walrusTex;
-		delete walrusSheet;
 		delete walrusSprite;
 	}
 
 	void Player::start()
 	{
-		walrusTex = Texture2D::create("assets/sprite/walrus.png");
-		walrusSheet = new SpriteSheet(walrusTex, 32, 32);
-		walrusSprite = new AnimatedSprite(walrusSheet);
-		idle = FrameAnimation(0, 0, 0);
-		run = FrameAnimation(4, 1, 0.2);
-		jump = FrameAnimation(0, 5, 0);
-		idleShoot = FrameAnimation(0, 8, 0, "idle");
-		runShoot = FrameAnimation(4, 9, 0.2, "run");
-		jumpShoot = FrameAnimation(0, 13, 0, "jump");
-		damaged = FrameAnimation(0, 6, 0);
-		climbing = FrameAnimation(2, 16, 0.2);
-		climbingShoot = FrameAnimation(0, 18, 0);
-		climbingFinish = FrameAnimation(0, 19, 0);
-		dead = FrameAnimation(0, 20, 0);
-		walrusSprite->addAnimation("idle", idle);
-		walrusSprite->addAnimation("run", run);
-		walrusSprite->addAnimation("jump", jump);
-		walrusSprite->addAnimation("idleShoot", idleShoot);
-		walrusSprite->addAnimation("runShoot", runShoot);
-		walrusSprite->addAnimation("jumpShoot", jumpShoot);
-		walrusSprite->addAnimation("damaged", damaged);
-		walrusSprite->addAnimation("climbing", climbing);
-		walrusSprite->addAnimation("climbingShoot", climbingShoot);
-		walrusSprite->addAnimation("climbingFinish", climbingFinish);
-		walrusSprite->addAnimation("dead", dead);
-		walrusSprite->play("idle");
+		if (walrusTex == nullptr)
+			walrusTex = Texture2D::create("assets/sprite/walrus.png");
+		if (walrusSheet == nullptr)
+			walrusSheet = new SpriteSheet(walrusTex, 32, 32);
+		if (walrusClips == nullptr)
+			walrusClips = utilities::JSONUtil::animated_sprite("assets/data/sprite/walrus.json", walrusSheet);
+		if (bulletTex == nullptr)
+			bulletTex = Texture2D::create("assets/sprite/bullet.png");
+
+		walrusSprite = new AnimatedSprite(*walrusClips);
+		animations.idle = walrusSprite->get_animationID("idle");
+		animations.run = walrusSprite->get_animationID("run");
+		animations.jump = walrusSprite->get_animationID("jump");
+		animations.idleShoot = walrusSprite->get_animationID("idleShoot");
+		animations.runShoot = walrusSprite->get_animationID("runShoot");
+		animations.jumpShoot = walrusSprite->get_animationID("jumpShoot");
+		animations.damaged = walrusSprite->get_animationID("damaged");
+		animations.climbing = walrusSprite->get_animationID("climbing");
+		animations.climbingShoot = walrusSprite->get_animationID("climbingShoot");
+		animations.climbingFinish = walrusSprite->get_animationID("climbingFinish");
+		animations.dead = walrusSprite->get_animationID("dead");
+		walrusSprite->play(animations.idle);
 
 		playerInfo.canJump = false;
 		playerInfo.canMove = true;
@@ -254,8 +255,6 @@ namespace metalwalrus
 		this->health = this->maxHealth;
 
 		playerStateMachine.push(new IdleState("idle", &playerStateMachine), *this);
-
-		bulletTex = Texture2D::create("assets/sprite/bullet.png");
 	}
 
 	void Player::update(double delta)
@@ -271,23 +270,15 @@ namespace metalwalrus
 			}
 		}
 
-		if (playerInfo.alive)
-		{
-			for (KillBox* k : GameScene::killBoxes)
-			{
-				if (boundingBox.intersects(k->get_boundingBox()))
-					this->die();
-			}
-		}
+		unsigned touching = GameScene::triggers.queryTypes(boundingBox);
+
+		if (playerInfo.alive && (touching & CollisionLayers::KILLBOX))
+			this->die();
 
-		for (LevelFinish* l : GameScene::levelFinish)
+		if (touching & CollisionLayers::LEVEL_FINISH)
 		{
-			if (boundingBox.intersects(l->get_boundingBox()))
-			{
-				((GameScene*)this->parentScene)->loadLevel(++GameScene::currentLevel);
-				return;
-			}
-			
+			((GameScene*)this->parentScene)->loadLevel(++GameScene::currentLevel);
+			return;
 		}
 		
 		if (damageImmunityFrameTimer <= 0)
@@ -306,42 +297,22 @@ namespace metalwalrus
 
 		if (velocity.y < GameScene::terminalVelocity) velocity.y = GameScene::terminalVelocity;
 
-		oldPosition = position;
-		AABB tbb;
-		Tile t;
-		moveBy(Vector2((velocity.x * delta), 0));
-		if (GameScene::loadedMap->boundingBoxCollides(boundingBox, tbb, t))
-		{
-			if (!t.is_oneWay())
-				moveTo(oldPosition);
-		}
+		GameScene::loadedMap->sweepX(boundingBox, velocity.x * delta, tileSweep);
+		moveBy(Vector2(tileSweep.distance, 0));
 
-		oldPosition = position;
-		moveBy(Vector2(0, (velocity.y * delta)));
-		if (GameScene::loadedMap->boundingBoxCollides(boundingBox, tbb, t))
+		GameScene::loadedMap->sweepY(boundingBox, velocity.y * delta, tileSweep);
+		moveBy(Vector2(0, tileSweep.distance));
+		if (tileSweep.hit)
 		{
-			if (t.is_oneWay() && oldPosition.y >= (tbb.get_top()-1))
-			{
-				moveTo(Vector2(position.x, tbb.get_top()));
-				if (!playerInfo.onGround)
-					AudioLocator::getAudio().playSound("assets/snd/sfx/player_land.wav");
-				playerInfo.onGround = true;
-				playerInfo.touchedGroundLastFrame = true;
-			}
-			else if (!t.is_oneWay() && oldPosition.y >= tbb.get_top())
+			if (tileSweep.normal.y > 0) // landed
 			{
-				moveTo(Vector2(position.x, tbb.get_top()));
 				if (!playerInfo.onGround)
-					AudioLocator::getAudio().playSound("assets/snd/sfx/player_land.wav");
+					AudioLocator::getAudio().playSound(Sounds::PLAYER_LAND);
 				playerInfo.onGround = true;
 				playerInfo.touchedGroundLastFrame = true;
 			}
-			else if (!t.is_oneWay() && (oldPosition.y + boundingBox.get_height()) < tbb.get_bottom())
-			{
-				moveTo(Vector2(position.x, tbb.get_bottom() - boundingBox.get_height()));
-			}
 
-			if (!t.is_oneWay())
+			if (!tileSweep.oneWay)
 			{
 				velocity.y = 0;
 				playerInfo.jumping = false;
@@ -368,15 +339,18 @@ namespace metalwalrus
 
 	void Player::draw(SpriteBatch& batch)
 	{
+		Vector2 drawPos = get_drawPosition();
 		TextureRegion *walrusKeyframe = walrusSprite->get_keyframe();
+		if (walrusKeyframe == nullptr)
+			return;
 		walrusKeyframe->set_flipX(playerInfo.facingLeft);
 		
-		batch.drawreg(*walrusKeyframe, position.x, position.y);
+		batch.drawreg(*walrusKeyframe, drawPos.x, drawPos.y);
 	}
 
 	void Player::takeDamage(int damageAmount, GameObject* damager)
 	{
-		if (!playerInfo.canTakeDamage || !playerInfo.alive)
+		if (!playerInfo.canTakeDamage || !playerInfo.alive || invulnerable)
 			return;
 
 		playerInfo.damaged = true;
@@ -391,7 +365,7 @@ namespace metalwalrus
 		
 		this->health -= damageAmount;
 
-		AudioLocator::getAudio().playSound("assets/snd/sfx/player_hurt.wav");
+		AudioLocator::getAudio().playSound(Sounds::PLAYER_HURT);
 
 		if (this->health <= 0)
 		{
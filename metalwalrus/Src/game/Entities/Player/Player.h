@@ -7,6 +7,7 @@
 #include "../../../Framework/Animation/AnimatedSprite.h"
 #include "../../../Framework/State/PushDownStateMachine.h"
 #include "../World/Ladder.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
@@ -29,6 +30,22 @@ namespace metalwalrus
 		bool canClimb;
 		bool facingLeftBeforeDamage;
 	};
+
+	// handles into the walrus sprite's clip table, resolved on start
+	struct PlayerAnimations
+	{
+		AnimationID idle;
+		AnimationID run;
+		AnimationID jump;
+		AnimationID idleShoot;
+		AnimationID runShoot;
+		AnimationID jumpShoot;
+		AnimationID damaged;
+		AnimationID climbing;
+		AnimationID climbingShoot;
+		AnimationID climbingFinish;
+		AnimationID dead;
+	};
 	
 	class Player : public SolidObject
 	{
@@ -45,25 +62,17 @@ namespace metalwalrus
 
 		PlayerState currentState = PlayerState::IDLE;
 
-		Texture2D *walrusTex;
-		SpriteSheet *walrusSheet;
+		// loaded by the first player and kept, so a respawn loads nothing
+		static Texture2D *walrusTex;
+		static SpriteSheet *walrusSheet;
+		static AnimatedSprite *walrusClips;
 
-		Texture2D *bulletTex;
+		static Texture2D *bulletTex;
 
 		AnimatedSprite *walrusSprite;
-		FrameAnimation idle;
-		FrameAnimation run;
-		FrameAnimation jump;
-		FrameAnimation idleShoot;
-		FrameAnimation runShoot;
-		FrameAnimation jumpShoot;
-		FrameAnimation damaged;
-		FrameAnimation climbing;
-		FrameAnimation climbingShoot;
-		FrameAnimation climbingFinish;
-		FrameAnimation dead;
-
-		Vector2 oldPosition;
+		PlayerAnimations animations;
+
+		TileSweep tileSweep; // reused by the per-axis tile queries
 
 		PlayerInfo playerInfo;
 
@@ -77,13 +86,21 @@ namespace metalwalrus
 		int damageImmunityFrameTimer;
 		int deathFrameTimer;
 
+		bool invulnerable = false;
+
 		void shoot();
 		void die();
 		void handleInput();
 		Ladder *checkCanClimb();
+
+		std::vector<SolidObject*> contacts; // scratch for broadphase queries
 	public:
 		Player(Vector2 position, float width, float height, Vector2 offset)
-			: SolidObject(position, width, height, offset) { }
+			: SolidObject(position, width, height, offset)
+		{
+			set_collisionLayer(CollisionLayers::PLAYER, CollisionLayers::ENEMY
+				| CollisionLayers::ENEMY_BULLET | CollisionLayers::PICKUP);
+		}
 		~Player();
 
 		void start() override;
@@ -91,10 +108,13 @@ namespace metalwalrus
 		void draw(SpriteBatch& batch) override;
 
 		void takeDamage(int damageAmount, GameObject* damager);
+		// damage is ignored, for stress runs that have to keep going
+		void set_invulnerable(bool invulnerable) { this->invulnerable = invulnerable; }
 
 		// methods used in modifying player state
 		PlayerInfo& get_playerInfo() { return this->playerInfo; }
 		AnimatedSprite* const get_animatedSprite() { return this->walrusSprite; }
+		const PlayerAnimations& get_animations() const { return this->animations; }
 		Vector2& get_velocity() { return this->velocity; }
 		int get_health() const { return this->health; }
 		void add_health(int health)
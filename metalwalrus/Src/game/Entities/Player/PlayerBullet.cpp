@@ -1,43 +1,51 @@
 #include "PlayerBullet.h"
 #include "../../Scenes/GameScene.h"
 #include "../Enemy/Enemy.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
+	static std::vector<SolidObject*> hits; // scratch for broadphase queries
+
+	ObjectPool<PlayerBullet> PlayerBullet::pool("PlayerBullet", 16);
+
 	PlayerBullet::PlayerBullet(Vector2 pos, bool facingLeft, Texture2D *bulletTex)
-		: SolidObject(pos, 8, 6, Vector2::ZERO), facingLeft(facingLeft), bulletTex(bulletTex), timer(0) { }
+		: SolidObject(pos, 8, 6, Vector2::ZERO), facingLeft(facingLeft), bulletTex(bulletTex), timer(0)
+	{
+		this->set_collisionLayer(CollisionLayers::PLAYER_BULLET, CollisionLayers::ENEMY);
+	}
 
 	void PlayerBullet::start()
 	{}
 
-	void PlayerBullet::update(double delta)
+	void PlayerBullet::prepare(double delta)
 	{
 		timer += delta;
+		step = Vector2((facingLeft ? -1 : 1) * bulletSpeed * delta, 0);
+	}
+
+	void PlayerBullet::update(double delta)
+	{
 		if (timer > lifeTime)
 		{
 			this->parentScene->destroyObject(this);
 			return;
 		}
 
-		Vector2 moveVec = Vector2((facingLeft ? -1 : 1) * bulletSpeed, 0);
-		
-		this->moveBy(moveVec * delta);
+		this->moveBy(step);
 
-		for (auto o : *GameScene::enemies)
+		hits.clear();
+		this->parentScene->get_broadPhase().query(boundingBox, CollisionLayers::ENEMY, hits);
+		if (hits.size() > 0)
 		{
-			Enemy *e = (Enemy*)o;
-			AABB ebb = e->get_boundingBox();
-			if (this->boundingBox.intersects(e->get_boundingBox()))
-			{
-				e->takeDamage(Player::shotDamage);
-				this->parentScene->destroyObject(this);
-				return;
-			}
+			((Enemy*)hits[0])->takeDamage(Player::shotDamage);
+			this->parentScene->destroyObject(this);
 		}
 	}
 
 	void PlayerBullet::draw(SpriteBatch & batch)
 	{
-		batch.drawtex(*bulletTex, position.x, position.y);
+		Vector2 drawPos = get_drawPosition();
+		batch.drawtex(*bulletTex, drawPos.x, drawPos.y);
 	}
 }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../../../Framework/Game/SolidObject.h"
+#include "../../../Framework/Game/ObjectPool.h"
 
 namespace metalwalrus
 {
@@ -12,12 +13,16 @@ namespace metalwalrus
 		const float lifeTime = 0.6;
 		Texture2D *bulletTex;
 		bool facingLeft = false;
+		Vector2 step; // worked out in prepare, applied in update
 
 		const int bulletSpeed = 200;
 	public:
+		static ObjectPool<PlayerBullet> pool;
+
 		PlayerBullet(Vector2 pos, bool facingLeft, Texture2D *bulletTex);
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 	};
@@ -4,7 +4,7 @@ namespace metalwalrus
 {
 	void RunState::enter(Player& p)
 	{
-		p.get_animatedSprite()->play("run");
+		p.get_animatedSprite()->play(p.get_animations().run);
 		p.get_playerInfo().canJump = true;
 	}
 
@@ -6,20 +6,20 @@ namespace metalwalrus
 	{
 		if (machine->peekBelow()->get_name() == "idle")
 		{
-			p.get_animatedSprite()->play("idleShoot");
+			p.get_animatedSprite()->play(p.get_animations().idleShoot);
 		}
 		else if (machine->peekBelow()->get_name() == "run")
 		{
 			int runFrames = p.get_animatedSprite()->get_currentAnim().get_currentFrameRelative();
-			p.get_animatedSprite()->playAtFrame("runShoot", runFrames);
+			p.get_animatedSprite()->playAtFrame(p.get_animations().runShoot, runFrames);
 		}
 		else if (machine->peekBelow()->get_name() == "inAir")
 		{
-			p.get_animatedSprite()->play("jumpShoot");
+			p.get_animatedSprite()->play(p.get_animations().jumpShoot);
 		}
 		else if (machine->peekBelow()->get_name() == "climbing")
 		{
-			p.get_animatedSprite()->play("climbingShoot");
+			p.get_animatedSprite()->play(p.get_animations().climbingShoot);
 		}
 		frameTimer = Player::framesBetweenShotAnimation;
 		p.get_playerInfo().canShoot = false;
@@ -35,13 +35,13 @@ namespace metalwalrus
 	{
 		if (p.get_playerInfo().onGround && p.get_playerInfo().moving)
 		{
-			p.get_animatedSprite()->play("runShoot");
+			p.get_animatedSprite()->play(p.get_animations().runShoot);
 			p.get_playerInfo().canJump = true;
 		}
 
 		if (p.get_playerInfo().onGround && !p.get_playerInfo().moving)
 		{
-			p.get_animatedSprite()->play("idleShoot");
+			p.get_animatedSprite()->play(p.get_animations().idleShoot);
 			p.get_playerInfo().canJump = true;
 		}
 
@@ -53,7 +53,7 @@ namespace metalwalrus
 
 		if (!p.get_playerInfo().onGround && !p.get_playerInfo().climbing)
 		{
-			p.get_animatedSprite()->play("jumpShoot");
+			p.get_animatedSprite()->play(p.get_animations().jumpShoot);
 			p.get_playerInfo().canJump = false;
 		}
 
@@ -8,7 +8,7 @@ namespace metalwalrus
 {
 	std::string EnemySpawn::staticClassname = "enemy_spawn";
 	
-	EnemySpawn::EnemySpawn(Vector2 position, picojson::value properties)
+	EnemySpawn::EnemySpawn(Vector2 position, const picojson::value& properties)
 		: WorldObject(position, 16, 16, "enemy_spawn", properties)
 	{
 		this->enemyType = properties.get("enemyType").get<std::string>();
@@ -19,12 +19,12 @@ namespace metalwalrus
 	void EnemySpawn::start()
 	{
 		if (enemyType == "floater")
-			this->parentScene->registerObject(new FloaterEnemy(this->position, this->hardEnemy, this->facingLeft));
+			this->parentScene->registerObject(FloaterEnemy::pool.create(this->position, this->hardEnemy, this->facingLeft));
 		else if (enemyType == "shooter")
-			this->parentScene->registerObject(new StationaryShooter(this->position, this->hardEnemy, this->facingLeft));
+			this->parentScene->registerObject(StationaryShooter::pool.create(this->position, this->hardEnemy, this->facingLeft));
 		else if (enemyType == "bouncing")
-			this->parentScene->registerObject(new BouncingRobot(this->position, this->hardEnemy, this->facingLeft));
+			this->parentScene->registerObject(BouncingRobot::pool.create(this->position, this->hardEnemy, this->facingLeft));
 		else if (enemyType == "robot")
-			this->parentScene->registerObject(new RobotShooter(this->position, this->hardEnemy, this->facingLeft));
+			this->parentScene->registerObject(RobotShooter::pool.create(this->position, this->hardEnemy, this->facingLeft));
 	}
 }
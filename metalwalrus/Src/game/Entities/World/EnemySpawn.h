@@ -15,7 +15,7 @@ namespace metalwalrus
 	public:
 		static std::string staticClassname;
 
-		EnemySpawn(Vector2 position, picojson::value properties);
+		EnemySpawn(Vector2 position, const picojson::value& properties);
 
 		void start() override;
 	};
@@ -1,61 +1,78 @@
 #include "HealthPowerup.h"
 #include "../../Scenes/GameScene.h"
 #include "../../../Framework/Audio/AudioLocator.h"
+#include "../../../Framework/Util/JSONUtil.h"
+#include "../../Sounds.h"
 
 namespace metalwalrus
 {
-	Vector2 oldPos;
+	ObjectPool<HealthPowerup> HealthPowerup::pool("HealthPowerup", 16);
+	Texture2D *HealthPowerup::healthTex;
+	SpriteSheet *HealthPowerup::healthSheet;
+	AnimatedSprite *HealthPowerup::healthClips;
+	TextureRegion *HealthPowerup::healthSmallSprite;
+	std::vector<AnimatedSprite*> HealthPowerup::spareSprites;
 	
 	HealthPowerup::~HealthPowerup()
 	{
-		delete healthTex;
-		delete healthSheet;
-		delete healthBigSprite;
+		if (healthBigSprite != nullptr)
+			spareSprites.push_back(healthBigSprite);
 	}
 
 	void HealthPowerup::start()
 	{
-		oldPos = position;
-
-		healthTex = Texture2D::create("assets/sprite/health.png");
-		healthSheet = new SpriteSheet(healthTex, 16, 16);
-		healthBigSprite = new AnimatedSprite(healthSheet);
-		healthBigSprite->addAnimation("main", FrameAnimation(2, 0, 0.3));
-		healthBigSprite->play("main");
-		healthSmallSprite = new TextureRegion(healthTex, 32, 0, 8, 8);
+		if (healthTex == nullptr)
+		{
+			healthTex = Texture2D::create("assets/sprite/health.png");
+			healthSheet = new SpriteSheet(healthTex, 16, 16);
+			healthClips = utilities::JSONUtil::animated_sprite("assets/data/sprite/health.json", healthSheet);
+			healthSmallSprite = new TextureRegion(healthTex, 32, 0, 8, 8);
+			spareSprites.reserve(pool.get_capacity());
+		}
 
-		p = (Player*)this->parentScene->getWithID(GameScene::playerID);
+		if (spareSprites.size() == 0)
+		{
+			healthBigSprite = new AnimatedSprite(*healthClips);
+			healthBigSprite->play(healthBigSprite->get_animationID("main"));
+		}
+		else
+		{
+			// recycled sprites are already on the main clip, just rewind them
+			healthBigSprite = spareSprites.back();
+			spareSprites.pop_back();
+			healthBigSprite->stop();
+			healthBigSprite->resume();
+		}
 	}
 
-	void HealthPowerup::update(double delta)
+	void HealthPowerup::prepare(double delta)
 	{
 		healthBigSprite->update(delta);
 		
 		velocity.y -= GameScene::gravity;
 		if (velocity.y < GameScene::terminalVelocity) velocity.y = GameScene::terminalVelocity;
 
-		oldPos = position;
-		this->moveBy(velocity * delta);
-		AABB tbb;
-		Tile t;
-		if (GameScene::loadedMap->boundingBoxCollides(this->boundingBox, tbb, t))
-		{
-			this->moveTo(Vector2(position.x, tbb.get_top()));
-		}
+		GameScene::loadedMap->sweepY(boundingBox, velocity.y * delta, tileSweep);
+	}
 
-		if (boundingBox.intersects(p->get_boundingBox()))
+	void HealthPowerup::update(double delta)
+	{
+		this->moveBy(Vector2(0, tileSweep.distance));
+
+		Player *p = (Player*)this->parentScene->getWithID(GameScene::playerID);
+		if (p != nullptr && boundingBox.intersects(p->get_boundingBox()))
 		{
 			p->add_health(isSmall ? this->smallHealing : this->largeHealing);
-			AudioLocator::getAudio().playSound("assets/snd/sfx/get_health.wav");
+			AudioLocator::getAudio().playSound(Sounds::GET_HEALTH);
 			this->parentScene->destroyObject(this);
 		}
 	}
 
 	void HealthPowerup::draw(SpriteBatch & batch)
 	{
-		if (isSmall)
-			batch.drawreg(*healthSmallSprite, position.x, position.y);
-		else
-			batch.drawreg(*healthBigSprite->get_keyframe(), position.x, position.y);
+		Vector2 drawPos = get_drawPosition();
+		TextureRegion *keyframe = isSmall ? healthSmallSprite : healthBigSprite->get_keyframe();
+		if (keyframe != nullptr)
+			batch.drawreg(*keyframe, drawPos.x, drawPos.y);
 	}
 }
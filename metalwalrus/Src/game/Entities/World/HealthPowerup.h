@@ -2,10 +2,14 @@
 #define HEALTHPOWERUP_H
 #pragma once
 
+#include <vector>
+
 #include "WorldObject.h"
+#include "../../../Framework/Game/ObjectPool.h"
 #include "../../../Framework/Graphics/TileMap.h"
 #include "../../../Framework/Animation/AnimatedSprite.h"
 #include "../Player/Player.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
@@ -13,23 +17,32 @@ namespace metalwalrus
 	{
 		bool isSmall;
 		Vector2 velocity;
+		TileSweep tileSweep;
 
 		const int smallHealing = 2;
 		const int largeHealing = 6;
 
-		Texture2D *healthTex;
-		SpriteSheet *healthSheet;
+		static Texture2D *healthTex;
+		static SpriteSheet *healthSheet;
+		static AnimatedSprite *healthClips;
+		static TextureRegion *healthSmallSprite;
+		// sprites of released powerups, handed to the next spawn so recycling
+		// a pooled powerup doesn't copy the clip table again
+		static std::vector<AnimatedSprite*> spareSprites;
 		AnimatedSprite *healthBigSprite;
-		TextureRegion *healthSmallSprite;
-
-		Player *p;
 	public:
-		HealthPowerup(Vector2 pos, bool isSmall, picojson::value properties)
+		static ObjectPool<HealthPowerup> pool;
+
+		HealthPowerup(Vector2 pos, bool isSmall, const picojson::value& properties)
 			: WorldObject(pos, isSmall ? 8 : 16, isSmall ? 8 : 16, "health_powerup", properties)
-			, isSmall(isSmall), velocity(Vector2::ZERO) { }
+			, isSmall(isSmall), velocity(Vector2::ZERO), healthBigSprite(nullptr)
+		{
+			set_collisionLayer(CollisionLayers::PICKUP, CollisionLayers::PLAYER);
+		}
 		~HealthPowerup();
 
 		void start() override;
+		void prepare(double delta) override;
 		void update(double delta) override;
 		void draw(SpriteBatch& batch) override;
 	};
@@ -1,11 +1,12 @@
 #include "KillBox.h"
 
 #include "../../Scenes/GameScene.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
 	void KillBox::start()
 	{
-		GameScene::killBoxes.push_back(this);
+		GameScene::triggers.add(this, CollisionLayers::KILLBOX);
 	}
 }
@@ -9,7 +9,7 @@ namespace metalwalrus
 	class KillBox : public WorldObject
 	{
 	public:
-		KillBox(Vector2 pos, picojson::value properties)
+		KillBox(Vector2 pos, const picojson::value& properties)
 			: WorldObject(pos, 16, 16, "killbox", properties) { }
 
 		void start() override;
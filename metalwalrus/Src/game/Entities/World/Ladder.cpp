@@ -1,5 +1,6 @@
 #include "Ladder.h"
 #include "../../Scenes/GameScene.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
@@ -7,6 +8,6 @@ namespace metalwalrus
 
 	void Ladder::start()
 	{
-		GameScene::ladders.push_back(this);
+		GameScene::triggers.add(this, CollisionLayers::LADDER);
 	}
 }
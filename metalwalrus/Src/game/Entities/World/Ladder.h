@@ -11,7 +11,7 @@ namespace metalwalrus
 	public:
 		static const std::string staticClassname;
 
-		Ladder(Vector2 pos, picojson::value properties)
+		Ladder(Vector2 pos, const picojson::value& properties)
 			: WorldObject(pos, 16, 16, "ladder", properties) { }
 
 		void start() override;
@@ -1,12 +1,13 @@
 #include "LevelFinish.h"
 
 #include "../../Scenes/GameScene.h"
+#include "../../CollisionLayers.h"
 
 namespace metalwalrus
 {
 	void LevelFinish::start()
 	{
-		GameScene::levelFinish.push_back(this);
+		GameScene::triggers.add(this, CollisionLayers::LEVEL_FINISH);
 	}
 
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace metalwalrus
 	class LevelFinish : public WorldObject
 	{
 	public:
-		LevelFinish(Vector2 pos, picojson::value properties)
+		LevelFinish(Vector2 pos, const picojson::value& properties)
 			: WorldObject(pos, 16, 16, "levelfinish", properties) { }
 
 		void start() override;
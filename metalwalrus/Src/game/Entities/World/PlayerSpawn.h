@@ -12,7 +12,7 @@ namespace metalwalrus
 	public:
 		static const std::string staticClassname;
 
-		PlayerSpawn(Vector2 position, picojson::value properties);
+		PlayerSpawn(Vector2 position, const picojson::value& properties);
 		~PlayerSpawn() { }
 
 		void start() override;
@@ -8,7 +8,7 @@
 namespace metalwalrus
 {
 	WorldObject* WorldObjectFactory::createObject(const std::string& classname, 
-		Vector2 pos, picojson::value properties)
+		Vector2 pos, const picojson::value& properties)
 	{
 		if (classname == PlayerSpawn::staticClassname) 
 			return new PlayerSpawn(pos, properties);
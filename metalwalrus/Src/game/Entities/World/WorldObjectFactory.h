@@ -10,7 +10,7 @@ namespace metalwalrus
 	{
 	public:
 		WorldObject *createObject(const std::string& classname, 
-			Vector2 pos, picojson::value properties);
+			Vector2 pos, const picojson::value& properties);
 	};
 }
 
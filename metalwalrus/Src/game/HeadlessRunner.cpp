@@ -0,0 +1,215 @@
+#include "HeadlessRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "Scenes/GameScene.h"
+#include "Scenes/StressScene.h"
+#include "Scenes/TitleScreenScene.h"
+#include "Controls.h"
+#include "../Framework/Settings.h"
+#include "../Framework/Audio/AudioLocator.h"
+#include "../Framework/Input/InputHandler.h"
+#include "../Framework/Input/InputRecording.h"
+#include "../Framework/Jobs/JobSystem.h"
+#include "../Framework/Scene/SceneManager.h"
+#include "../Framework/Util/AllocationTracker.h"
+#include "../Framework/Util/FrameArena.h"
+#include "../Framework/Util/Profiler.h"
+
+namespace metalwalrus
+{
+	typedef std::chrono::high_resolution_clock RunClock;
+
+	static const unsigned headlessSeed = 1; // fixed so runs are comparable
+
+	int HeadlessRunner::allocBudget = -1;
+	int HeadlessRunner::allocWarmup = 60;
+
+	int HeadlessRunner::run(int level, int ticks, const std::string& recordPath)
+	{
+		Settings::HEADLESS = true;
+		AudioLocator::initialize(); // null audio, nothing is ever provided
+		Controls::initialize();
+		srand(headlessSeed);
+
+		if (recordPath != "")
+			InputRecording::startRecording(recordPath, InputHandler::get_inputCount(), headlessSeed, level);
+
+		RunClock::time_point loadStart = RunClock::now();
+		SceneManager::addScene(new GameScene(level));
+		double loadMs = std::chrono::duration<double, std::milli>(RunClock::now() - loadStart).count();
+
+		int result = simulate("level " + std::to_string(level), loadMs, ticks);
+		if (recordPath != "" && !InputRecording::save())
+			result = 1;
+		InputRecording::stop();
+		return result;
+	}
+
+	int HeadlessRunner::replay(const std::string& path)
+	{
+		Settings::HEADLESS = true;
+		AudioLocator::initialize();
+		Controls::initialize();
+
+		if (!InputRecording::startReplay(path))
+			return 1;
+		srand(InputRecording::get_seed());
+
+		// level -1 is the title screen, where the windowed game starts
+		int level = InputRecording::get_startLevel();
+		RunClock::time_point loadStart = RunClock::now();
+		if (level < 0)
+			SceneManager::addScene(new TitleScreenScene());
+		else
+			SceneManager::addScene(new GameScene(level));
+		double loadMs = std::chrono::duration<double, std::milli>(RunClock::now() - loadStart).count();
+
+		int result = simulate("replay " + path, loadMs, InputRecording::get_tickCount());
+		if (InputRecording::get_divergedTick() != -1)
+		{
+			std::cout << "  diverged on tick " << InputRecording::get_divergedTick() << "\n";
+			result = 1;
+		}
+		else
+		{
+			std::cout << "  replay matched\n";
+		}
+		InputRecording::stop();
+		return result;
+	}
+
+	int HeadlessRunner::stress(const std::vector<int>& counts, int ticksPerStep, unsigned seed,
+		const StressMix& mix)
+	{
+		const double dt = 1.0 / 60.0;
+
+		Settings::HEADLESS = true;
+		AudioLocator::initialize();
+		Controls::initialize();
+		srand(seed);
+
+		StressScene *scene = new StressScene(seed, counts, ticksPerStep, mix);
+		SceneManager::addScene(scene);
+		while (!scene->is_finished())
+		{
+			InputHandler::handleInput();
+			SceneManager::update(dt);
+			AudioLocator::getAudio().update();
+			FrameArena::reset();
+			AllocationTracker::endFrame();
+		}
+
+		std::cout << "headless " << JobSystem::get_threadCount() << " threads, ";
+		scene->report(std::cout);
+		SceneManager::clearScenes();
+		AudioLocator::dispose();
+		return 0;
+	}
+
+	int HeadlessRunner::simulate(const std::string& title, double loadMs, int ticks)
+	{
+		const double dt = 1.0 / 60.0;
+
+		Profiler::reset();
+		Profiler::enabled = true;
+
+		if (allocBudget >= 0 && !AllocationTracker::is_enabled())
+		{
+			std::cout << "allocation budget needs a build with TRACK_ALLOCATIONS\n";
+			return 1;
+		}
+		// a level load in the middle of a run (the player died) isn't steady state
+		ProfileSection loadSection = Profiler::section("level load");
+		long long steadyAllocs = 0;
+		long long maxTickAllocs = 0;
+		int overBudgetTicks = 0;
+		int firstOverBudget = -1;
+
+		std::vector<double> tickMs;
+		tickMs.reserve(ticks);
+		RunClock::time_point runStart = RunClock::now();
+		for (int i = 0; i < ticks; i++)
+		{
+			AllocationCounts tickStart = AllocationTracker::get_simulation();
+			int loadsBefore = Profiler::get_calls(loadSection);
+
+			RunClock::time_point start = RunClock::now();
+			InputHandler::handleInput();
+			SceneManager::update(dt);
+			AudioLocator::getAudio().update();
+			tickMs.push_back(std::chrono::duration<double, std::milli>(RunClock::now() - start).count());
+
+			if (InputRecording::is_active())
+			{
+				InputRecording::endTick(SceneManager::hashState());
+				if (InputRecording::get_divergedTick() != -1)
+					break; // nothing after the first difference is worth comparing
+			}
+			FrameArena::reset();
+			AllocationTracker::endFrame();
+
+			long long tickAllocs = (AllocationTracker::get_simulation() - tickStart).allocs;
+			if (i >= allocWarmup && Profiler::get_calls(loadSection) == loadsBefore)
+			{
+				steadyAllocs += tickAllocs;
+				maxTickAllocs = std::max(maxTickAllocs, tickAllocs);
+				if (allocBudget >= 0 && tickAllocs > allocBudget)
+				{
+					if (firstOverBudget == -1)
+						firstOverBudget = i;
+					overBudgetTicks++;
+				}
+			}
+		}
+		double runSeconds = std::chrono::duration<double>(RunClock::now() - runStart).count();
+		ticks = tickMs.size();
+
+		Profiler::enabled = false;
+		SceneManager::clearScenes();
+		AudioLocator::dispose();
+
+		std::vector<double> sorted = tickMs;
+		std::sort(sorted.begin(), sorted.end());
+		auto percentile = [&sorted](double p) {
+			if (sorted.size() == 0)
+				return 0.0;
+			return sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+		};
+
+		std::cout << "headless run: " << title << ", " << ticks << " ticks, "
+			<< JobSystem::get_threadCount() << " threads\n"
+			<< "  load:       " << loadMs << " ms\n"
+			<< "  ticks/sec:  " << (runSeconds > 0 ? ticks / runSeconds : 0) << "\n"
+			<< "  tick p50:   " << percentile(0.5) << " ms\n"
+			<< "  tick p99:   " << percentile(0.99) << " ms\n"
+			<< "  tick max:   " << (sorted.size() > 0 ? sorted.back() : 0) << " ms\n";
+		for (ProfileSection s = 0; s < Profiler::get_sectionCount(); s++)
+		{
+			if (Profiler::get_calls(s) == 0)
+				continue;
+			std::cout << "  " << Profiler::get_name(s) << ": "
+				<< Profiler::get_total(s) * 1000.0 / std::max(ticks, 1) << " ms/tick ("
+				<< Profiler::get_calls(s) << " calls";
+			if (AllocationTracker::is_enabled())
+				std::cout << ", " << Profiler::get_allocs(s) << " allocs, " << Profiler::get_bytes(s) << " bytes";
+			std::cout << ")\n";
+		}
+
+		if (AllocationTracker::is_enabled())
+		{
+			std::cout << "  steady allocs: " << steadyAllocs << " (max " << maxTickAllocs << " in a tick)\n";
+			if (overBudgetTicks > 0)
+			{
+				std::cout << "  " << overBudgetTicks << " ticks over the budget of " << allocBudget
+					<< " allocs, first on tick " << firstOverBudget << "\n";
+				return 1;
+			}
+		}
+		return 0;
+	}
+}
@@ -0,0 +1,43 @@
+#ifndef HEADLESSRUNNER_H
+#define HEADLESSRUNNER_H
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace metalwalrus
+{
+	struct StressMix;
+
+	// runs the game scene without a window, GL context or audio device,
+	// stepping fixed ticks as fast as possible and reporting tick cost
+	// to stdout. used to catch simulation regressions on build machines
+	class HeadlessRunner
+	{
+		static int allocBudget;
+		static int allocWarmup;
+
+		static int simulate(const std::string& title, double loadMs, int ticks);
+
+		HeadlessRunner(); // static class
+	public:
+		// recordPath, if given, saves the run so it can be replayed
+		static int run(int level = 0, int ticks = 3600, const std::string& recordPath = "");
+		// plays a recording back, returns nonzero as soon as the state diverges
+		static int replay(const std::string& path);
+		// times a generated level at each entity count, see StressScene
+		static int stress(const std::vector<int>& counts, int ticksPerStep, unsigned seed,
+			const StressMix& mix);
+
+		// fails the run if a tick after the first warmupTicks makes more than
+		// budget allocations, ticks that load a level don't count. -1 is off.
+		// only the main thread and the job workers are counted
+		static void set_allocBudget(int budget, int warmupTicks = 60)
+		{
+			allocBudget = budget;
+			allocWarmup = warmupTicks;
+		}
+	};
+}
+
+#endif // HEADLESSRUNNER_H
@@ -25,9 +25,16 @@ using namespace std;
 #include "../Framework/Graphics/TileMap.h"
 #include "../Framework/Input/InputHandler.h"
 #include "../Framework/Util/Debug.h"
+#include "../Framework/Util/AllocationTracker.h"
+#include "../Framework/Util/FrameArena.h"
+#include "../Framework/Game/ObjectPool.h"
 #include "../Framework/Audio/PCAudio.h"
+#include "../Framework/Audio/AsyncAudio.h"
+#include "../Framework/Audio/MixerAudio.h"
+#include "../Framework/Audio/WavSink.h"
 #include "../Framework/Audio/AudioLocator.h"
 
+#include "Controls.h"
 #include "Entities/Player/Player.h"
 
 namespace metalwalrus
@@ -45,6 +52,8 @@ namespace metalwalrus
 
 	SpriteBatch *debugBatch;
 
+	AsyncAudio *asyncAudio; // owned by the audio locator
+
 	MetalWalrus::~MetalWalrus()
 	{
 		SceneManager::clearScenes();
@@ -58,25 +67,28 @@ namespace metalwalrus
 
 	void MetalWalrus::start()
 	{
-		// create audio device
+		// create audio device, driven from its own thread
 		AudioLocator::initialize();
-		irrklang::ISoundEngine *engine = irrklang::createIrrKlangDevice();
-		PCAudio *audioService = nullptr;
-		if (engine != nullptr)
+		asyncAudio = nullptr;
+		if (mixerOutput != "")
+		{
+			AudioSink *sink = nullptr;
+			if (mixerOutput == "null")
+				sink = new NullSink();
+			else
+				sink = new WavSink(mixerOutput, MixerAudio::SAMPLE_RATE);
+			asyncAudio = new AsyncAudio(new MixerAudio(sink));
+		}
+		else
 		{
-			audioService = new PCAudio(engine);
+			irrklang::ISoundEngine *engine = irrklang::createIrrKlangDevice();
+			if (engine != nullptr)
+				asyncAudio = new AsyncAudio(new PCAudio(engine));
 		}
-		AudioLocator::provide(audioService);
+		AudioLocator::provide(asyncAudio);
 		
 		// initialize inputs
-		InputHandler::addInput("left", GLFW_KEY_LEFT);
-		InputHandler::addInput("up", GLFW_KEY_UP);
-		InputHandler::addInput("down", GLFW_KEY_DOWN);
-		InputHandler::addInput("right", GLFW_KEY_RIGHT);
-		InputHandler::addInput("shoot", GLFW_KEY_X);
-		InputHandler::addInput("a", GLFW_KEY_Z);
-		InputHandler::addInput("esc", GLFW_KEY_ESCAPE);
-		InputHandler::addInput("f5", GLFW_KEY_F5);
+		Controls::initialize();
 
 		// load fonts
 		fontTex = Texture2D::create("assets/font.png");
@@ -106,10 +118,11 @@ namespace metalwalrus
 	void MetalWalrus::update(double delta)
 	{
 		// toggle debug mode
-		if (InputHandler::checkButton("f5", ButtonState::DOWN))
+		if (InputHandler::checkButton(Controls::DEBUG, ButtonState::DOWN))
 			Debug::debugMode = !Debug::debugMode;
 
 		SceneManager::update(delta);
+		AudioLocator::getAudio().update();
 	}
 
 	void MetalWalrus::draw()
@@ -156,9 +169,36 @@ namespace metalwalrus
 
 	void MetalWalrus::drawDebug(SpriteBatch& batch)
 	{
-		string debugString = "FT:  " + std::to_string(Debug::frameTime) + "\n"
-			+ "DC:  " + std::to_string(SpriteBatch::totalRenderCalls) + "\n"
-			+ "FPS: " + std::to_string(Debug::fps);
-		fontSheet->drawText(batch, debugString, 0, 232);
+		// built in the frame arena so the overlay doesn't allocate every frame
+		FrameString debugString(FrameArena::format("FT:  %f\nDC:  %d\nFPS: %f",
+			Debug::frameTime, SpriteBatch::totalRenderCalls, Debug::fps));
+
+		// last frame's heap traffic, every thread
+		if (AllocationTracker::is_enabled())
+		{
+			const AllocationCounts& allocs = AllocationTracker::get_lastFrame();
+			debugString += FrameArena::format("\nAL:  %lld FR %lld B %lld",
+				allocs.allocs, allocs.frees, allocs.bytes);
+		}
+
+		// pools, in use / capacity and high-water mark
+		for (auto pool : IObjectPool::get_pools())
+		{
+			debugString += FrameArena::format("\n%s %d/%d HW %d", pool->get_name().c_str(),
+				pool->get_inUse(), pool->get_capacity(), pool->get_highWater());
+			if (pool->get_overflows() > 0)
+				debugString += FrameArena::format(" OF %d", pool->get_overflows());
+		}
+
+		if (asyncAudio != nullptr)
+		{
+			debugString += FrameArena::format("\nAQ HW %u", asyncAudio->get_highWater());
+			if (asyncAudio->get_dropped() > 0)
+				debugString += FrameArena::format(" DR %d", asyncAudio->get_dropped());
+			if (asyncAudio->get_stalls() > 0)
+				debugString += FrameArena::format(" ST %d", asyncAudio->get_stalls());
+		}
+
+		fontSheet->drawText(batch, debugString.c_str(), 0, 232);
 	}
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define METALWALRUS_H
 #pragma once
 
+#include <string>
+
 #include "../Framework/Game.h"
 
 namespace metalwalrus
@@ -15,6 +17,10 @@ namespace metalwalrus
 			: Game(windowTitle, w, h, context) { }
 		~MetalWalrus();
 
+		// empty uses irrKlang, otherwise the software mixer writes to this
+		// .wav, or to nowhere if it's "null"
+		std::string mixerOutput;
+
 		void start() override;
 		void update(double delta) override;
 		void draw() override;
@@ -5,21 +5,27 @@
 #include "../Entities/World/WorldObjectFactory.h"
 
 #include "../Entities/Enemy/Enemy.h"
+#include "../CollisionLayers.h"
 #include "../../Framework/Util/Debug.h"
 #include "../../Framework/Graphics/FontSheet.h"
+#include "../../Framework/Graphics/GLContext.h"
 
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
+#include <chrono>
 #include "../../Framework/Audio/AudioLocator.h"
+#include "../../Framework/Jobs/JobSystem.h"
+#include "../../Framework/Util/Profiler.h"
+#include "../../Framework/Util/Hash.h"
+#include "../../Framework/Util/FramePacer.h"
+#include "../../Framework/Util/FrameArena.h"
+#include "../../Framework/Settings.h"
+#include "../Sounds.h"
 
 namespace metalwalrus
 {
 	TileMap *GameScene::loadedMap = nullptr;
-	int GameScene::playerID = -1;
-	vector<GameObject*> *GameScene::enemies;
-	vector<Ladder*> GameScene::ladders;
-	vector<KillBox*> GameScene::killBoxes;
-	vector<LevelFinish*> GameScene::levelFinish;
+	ObjectHandle GameScene::playerID;
+	TriggerIndex GameScene::triggers;
 	Camera *GameScene::camera;
 	int GameScene::currentLevel;
 	const float GameScene::gravity = 40;
@@ -27,6 +33,13 @@ namespace metalwalrus
 	bool GameScene::playerDead;
 
 	Player *player = nullptr;
+	std::vector<SolidObject*> touchingEnemies;
+
+	static const ProfileSection profileContact = Profiler::section("contact damage");
+	static const ProfileSection profilePrepare = Profiler::section("prepare");
+	static const ProfileSection profileUpdate = Profiler::section("update");
+	static const ProfileSection profileFlush = Profiler::section("flush destroyed");
+	static const ProfileSection profileLoad = Profiler::section("level load");
 
 	Texture2D *healthBarTex;
 	Texture2D *healthBarEmptyTex;
@@ -36,52 +49,68 @@ namespace metalwalrus
 	FontSheet *font;
 	Vector2 scorePos = Vector2(102, 216);
 
-	std::string zeroPadNumber(int num, int width)
+	const char *zeroPadNumber(int num, int width)
 	{
-		std::stringstream ss;
-		ss << std::setw(width) << std::setfill('0') << num;
-		return ss.str();
+		return FrameArena::format("%0*d", width, num);
 	}
 	
-	void GameScene::loadMapObjects()
+	LevelSnapshot *GameScene::snapshotLevel(int levelIndex)
 	{
-		TileLayer *objectLayer = loadedMap->get_layer("Entities");
+		LevelSnapshot *level = new LevelSnapshot();
+		level->map = utilities::JSONUtil::tiled_tilemap("assets/data/level/" + levels[levelIndex], this->camera);
+		level->clearColor = GLContext::clearColor; // set from the map's properties
+
+		TileLayer *objectLayer = level->map->get_layer("Entities");
 		PropertyContainer *sheetProperties = nullptr;
-		WorldObjectFactory woFactory;
-		for (int y = 0; y < loadedMap->get_height(); y++)
+		for (int y = 0; y < level->map->get_height(); y++)
 		{
-			for (int x = 0; x < loadedMap->get_width(); x++)
+			for (int x = 0; x < level->map->get_width(); x++)
 			{
 				Tile *t = &objectLayer->get(x, y);
 
 				if (t->get_tileID() == 0) continue;
 
 				if (sheetProperties == nullptr) 
-					sheetProperties = &loadedMap->get_sheetFromTileID(t->get_tileID()).properties;
+					sheetProperties = &level->map->get_sheetFromTileID(t->get_tileID()).properties;
 
-				picojson::value tileProperties = sheetProperties->getTileProperties(t->get_sheetID() - 1);
-
-				Vector2 tilePos = t->get_position();
-				std::string classname = tileProperties.get("classname").get<std::string>();
-				this->registerObject(woFactory.createObject(classname, tilePos, tileProperties));
+				LevelSpawn spawn;
+				spawn.properties = sheetProperties->getTileProperties(t->get_sheetID() - 1);
+				spawn.classname = spawn.properties.get("classname").get<std::string>();
+				spawn.position = t->get_position();
+				level->spawns.push_back(spawn);
 			}
 		}
+		return level;
+	}
+
+	void GameScene::spawnLevelObjects(const LevelSnapshot& level)
+	{
+		WorldObjectFactory woFactory;
+		for (const LevelSpawn& spawn : level.spawns)
+			this->registerObject(woFactory.createObject(spawn.classname, spawn.position, spawn.properties));
 	}
 
 	void GameScene::onLevelLoad()
 	{
 		player = (Player*)this->getWithID(playerID);
 		GameScene::playerDead = false;
+		levelLoaded = true;
 	}
 
 	GameScene::~GameScene()
 	{
-		delete loadedMap;
+		for (LevelSnapshot *level : snapshots)
+		{
+			if (level != nullptr)
+				delete level->map;
+			delete level;
+		}
+		loadedMap = nullptr; // static, and it pointed into the snapshots
 		delete camera;
+		camera = nullptr;
+		triggers.clear();
 		delete batch;
 
-		delete enemies;
-
 		delete healthBarTex;
 		delete healthBarEmptyTex;
 
@@ -94,8 +123,10 @@ namespace metalwalrus
 		levels.push_back("level1.json");
 		levels.push_back("level2.json");
 		levels.push_back("level3.json");
+		snapshots.resize(levels.size(), nullptr);
 
-		AudioLocator::getAudio().playSound("assets/snd/music/mw8.ogg", true);
+		AudioLocator::getAudio().playSound("assets/snd/music/mw8.wav", true);
+		Sounds::load();
 
 		this->updateable = true;
 		
@@ -105,10 +136,10 @@ namespace metalwalrus
 		// create camera
 		camera = new Camera();
 
-		enemies = new std::vector<GameObject*>();
-
-		currentLevel = 0;
-		this->loadLevel(0);
+		if (startLevel < 0 || startLevel >= levels.size())
+			startLevel = 0;
+		currentLevel = startLevel;
+		this->loadLevel(startLevel);
 
 		healthBarTex = Texture2D::create("assets/sprite/healthbar.png");
 		healthBarEmptyTex = Texture2D::create("assets/sprite/healthbar-empty.png");
@@ -119,16 +150,58 @@ namespace metalwalrus
 
 	void GameScene::update(double delta)
 	{
-		*enemies = this->getWithTag("enemy");
+		levelLoaded = false;
+		for (int i = 0; i < objects.size(); i++)
+			objects[i]->savePosition();
 
-		for (GameObject* e : *enemies)
-			((Enemy*)e)->damagePlayer();
+		{
+			ProfileScope scope(profileContact);
+			touchingEnemies.clear();
+			this->get_broadPhase().query(player->get_boundingBox(), CollisionLayers::ENEMY, touchingEnemies);
+			for (auto e : touchingEnemies)
+				((Enemy*)e)->damagePlayer();
+		}
 
-		for (int i = 0; i < objects.size(); i++)
+		if (GameScene::playerDead)
+			return;
+
+		// phase one, every object works out its next state from this tick's
+		// snapshot. objects only write their own state so the result doesn't
+		// depend on how the work is split between threads
+		int prepared = objects.size();
 		{
-			if (GameScene::playerDead)
-				return;
-			objects[i]->update(delta);
+			ProfileScope scope(profilePrepare);
+			JobSystem::parallel_for(prepared, 64, [this, delta](int begin, int end) {
+				for (int i = begin; i < end; i++)
+				{
+					if (!objects[i]->is_destroyed())
+						objects[i]->prepare(delta);
+				}
+			});
+		}
+
+		// phase two, serially and in object order, apply movement, damage,
+		// spawns, destroys and sounds
+		{
+			ProfileScope scope(profileUpdate);
+			for (int i = 0; i < objects.size(); i++)
+			{
+				// the player died or finished the level and objects is now
+				// the next level's, none of them were prepared. they start
+				// next tick
+				if (GameScene::playerDead || levelLoaded)
+					return;
+				if (objects[i]->is_destroyed())
+					continue;
+				if (i >= prepared)
+					objects[i]->prepare(delta); // spawned this tick
+				objects[i]->update(delta);
+			}
+		}
+
+		{
+			ProfileScope scope(profileFlush);
+			this->flushDestroyed();
 		}
 
 		if (player->get_playerInfo().alive)
@@ -138,8 +211,25 @@ namespace metalwalrus
 		}
 	}
 
+	uint32_t GameScene::hashState(uint32_t hash) const
+	{
+		using utilities::Hash;
+		hash = IScene::hashState(hash);
+		hash = Hash::add(hash, currentLevel);
+		if (player != nullptr)
+		{
+			hash = Hash::add(hash, player->get_health());
+			hash = Hash::add(hash, player->get_score());
+		}
+		return hash;
+	}
+
 	void GameScene::draw()
 	{
+		// follow where the player is drawn rather than where it is
+		if (FramePacer::is_interpolating() && player->get_playerInfo().alive)
+			camera->centerOn(player->get_drawPosition() + (player->get_center() - player->get_position()));
+
 		// set to world coords
 		batch->setTransformMat(camera->getTransform());
 
@@ -154,6 +244,7 @@ namespace metalwalrus
 
 		if (Debug::debugMode)
 		{
+			loadedMap->drawDebug();
 			for (int i = 0; i < objects.size(); i++)
 				objects[i]->drawDebug();
 		}
@@ -169,7 +260,7 @@ namespace metalwalrus
 				healthBarPos.y + (healthBarTex->get_height() * i));
 		}
 
-		std::string scoreString = zeroPadNumber(player->get_score(), 7);
+		const char *scoreString = zeroPadNumber(player->get_score(), 7);
 		batch->setColor(Color::BLACK);
 		font->drawText(*batch, scoreString, scorePos.x + 1, scorePos.y - 1);
 		batch->setColor(Color::WHITE);
@@ -180,20 +271,45 @@ namespace metalwalrus
 		
 	}
 
+	float GameScene::screenPan(Vector2 worldPos)
+	{
+		if (camera == nullptr)
+			return 0;
+		float pan = (worldPos.x - camera->getPosition().x) / Settings::VIRTUAL_WIDTH * 2 - 1;
+		return std::max(-1.0f, std::min(pan, 1.0f));
+	}
+
 	void GameScene::loadLevel(int levelIndex)
 	{
+		ProfileScope scope(profileLoad);
+#if LOG_LEVEL <= 0
+		std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+#endif
 		this->destroyAllObjects();
-
-		enemies->clear();
-		ladders.clear();
-		killBoxes.clear();
-		levelFinish.clear();
+		triggers.clear();
 
 		currentLevel = levelIndex;
-		
-		loadedMap = utilities::JSONUtil::tiled_tilemap("assets/data/level/" + levels[levelIndex], this->camera);
-		loadMapObjects();
+
+		// only the first load of a level touches the disk, a restart after
+		// dying just respawns the objects
+		bool cached = snapshots[levelIndex] != nullptr;
+		if (!cached)
+			snapshots[levelIndex] = snapshotLevel(levelIndex);
+		LevelSnapshot *level = snapshots[levelIndex];
+
+		loadedMap = level->map;
+		GLContext::clearColor = level->clearColor;
+		spawnLevelObjects(*level);
+
+		SpriteSheet *tiles = loadedMap->get_sheets()[0];
+		triggers.bake(loadedMap->get_width(), loadedMap->get_height(),
+			tiles->get_spriteWidth(), tiles->get_spriteHeight());
 
 		onLevelLoad();
+
+#if LOG_LEVEL <= 0
+		LOG_MESSAGE("%s %s in %.2f ms", cached ? "Reset" : "Loaded", levels[levelIndex].c_str(),
+			std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count());
+#endif
 	}
 }
@@ -2,44 +2,72 @@
 #define GAMESCENE_H
 #pragma once
 
+#include <picojson.h>
+
 #include "../../Framework/Scene/IScene.h"
+#include "../../Framework/Graphics/Color.h"
 #include "../../Framework/Graphics/TileMap.h"
 #include "../../Framework/Graphics/Camera.h"
+#include "../../Framework/Physics/TriggerIndex.h"
 
 #include "../Entities/Player/Player.h"
-#include "../Entities/World/Ladder.h"
-#include "../Entities/World/KillBox.h"
-#include "../Entities/World/LevelFinish.h"
 
 namespace metalwalrus
 {
+	// an object from a level's entity layer
+	struct LevelSpawn
+	{
+		std::string classname;
+		Vector2 position;
+		picojson::value properties;
+	};
+
+	// a level as it was parsed on its first load. restarts reuse the map
+	// and its sheets and respawn the objects from here
+	struct LevelSnapshot
+	{
+		TileMap *map;
+		Color clearColor;
+		std::vector<LevelSpawn> spawns;
+	};
+
 	class GameScene : public IScene
 	{
-		static Camera *camera;
 		SpriteBatch *batch;
 		std::vector<std::string> levels;
+		std::vector<LevelSnapshot*> snapshots; // by level index, null until loaded
+		int startLevel;
+		bool levelLoaded; // set by a load, the rest of that tick's loop is skipped
 
-		void loadMapObjects();
+		LevelSnapshot *snapshotLevel(int levelIndex);
+		void spawnLevelObjects(const LevelSnapshot& level);
+	protected:
+		static Camera *camera;
+
+		// finds the player once a level's objects are registered
 		void onLevelLoad();
 	public:
+		GameScene(int startLevel = 0) : startLevel(startLevel), levelLoaded(false) { }
 		~GameScene();
 
 		void start() override;
 		void update(double delta) override;
 		void draw() override;
+		uint32_t hashState(uint32_t hash) const override;
 
 		static TileMap *loadedMap;
-		static int playerID;
-		static std::vector<GameObject*> *enemies;
-		static std::vector<Ladder*> ladders;
-		static std::vector<KillBox*> killBoxes;
-		static std::vector<LevelFinish*> levelFinish;
+		static ObjectHandle playerID;
+		static TriggerIndex triggers; // ladders, kill boxes and level finishes, baked on load
 		static int currentLevel;
 		static const float gravity;
 		static const float terminalVelocity;
 		static bool playerDead;
 
-		void loadLevel(int levelIndex);
+		// -1 at the left edge of the view to 1 at the right, for panning sounds
+		static float screenPan(Vector2 worldPos);
+
+		// the player reloads through this when it dies or finishes a level
+		virtual void loadLevel(int levelIndex);
 	};
 }
 
@@ -0,0 +1,345 @@
+#include "StressScene.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+#include "../../Framework/Graphics/GLContext.h"
+#include "../../Framework/Settings.h"
+#include "../../Framework/Util/Debug.h"
+#include "../../Framework/Util/JSONUtil.h"
+#include "../../Framework/Util/Profiler.h"
+#include "../Entities/Enemy/EnemyBullet.h"
+#include "../Entities/Enemy/BouncingRobot/BouncingRobot.h"
+#include "../Entities/Enemy/Floater/FloaterEnemy.h"
+#include "../Entities/Enemy/RobotShooter/RobotShooter.h"
+#include "../Entities/Enemy/StationaryShooter/StationaryShooter.h"
+#include "../Entities/Player/PlayerBullet.h"
+#include "../Entities/World/HealthPowerup.h"
+
+namespace metalwalrus
+{
+	typedef std::chrono::steady_clock StressClock;
+
+	static const ProfileSection profileLoad = Profiler::section("level load");
+
+	const StressMix StressMix::defaultWeights = { 20, 20, 20, 20, 15, 5 };
+
+	// tiles of the stock tileset, ids are 1-based like in Tiled
+	static const unsigned groundTile = 1;
+	static const unsigned platformTile = 12; // one-way
+	static const unsigned mapHeight = 40;
+	static const int entitiesPerColumn = 8;
+
+	StressMix StressMix::split(int total) const
+	{
+		long long sum = std::max(get_total(), 1);
+		StressMix m;
+		m.floaters = (int)(total * (long long)floaters / sum);
+		m.shooters = (int)(total * (long long)shooters / sum);
+		m.bouncers = (int)(total * (long long)bouncers / sum);
+		m.robots = (int)(total * (long long)robots / sum);
+		m.bullets = (int)(total * (long long)bullets / sum);
+		m.powerups = (int)(total * (long long)powerups / sum);
+
+		// rounding down loses a few, give them to the first type that has any
+		int left = total - m.get_total();
+		int *counts[] = { &m.floaters, &m.shooters, &m.bouncers, &m.robots, &m.bullets, &m.powerups };
+		const int *weightCounts[] = { &floaters, &shooters, &bouncers, &robots, &bullets, &powerups };
+		for (int i = 0; i < 6; i++)
+		{
+			if (*weightCounts[i] > 0)
+			{
+				*counts[i] += left;
+				break;
+			}
+		}
+		return m;
+	}
+
+	StressScene::StressScene(unsigned seed, const std::vector<int>& counts, int ticksPerStep,
+		const StressMix& weights)
+		: GameScene(0), seed(seed), counts(counts), ticksPerStep(std::max(ticksPerStep, 1)),
+		weights(weights), step(0), bulletTex(nullptr), drawMs(0), draws(0)
+	{
+		if (this->counts.size() == 0)
+			this->counts.push_back(1000);
+	}
+
+	StressScene::~StressScene()
+	{
+		// the generated maps aren't in GameScene's snapshots
+		delete loadedMap;
+		loadedMap = nullptr;
+		delete bulletTex;
+	}
+
+	std::vector<int> StressScene::defaultSweep()
+	{
+		return { 10, 30, 100, 300, 1000, 3000, 10000, 30000, 100000 };
+	}
+
+	TileMap *StressScene::generateMap(int entities)
+	{
+		unsigned width = std::max(64, entities / entitiesPerColumn + 32);
+		TileMap *tm = new TileMap(width, mapHeight, camera);
+		SpriteSheet *tileSheet = utilities::JSONUtil::tiled_spritesheet("assets/data/tileset/0001.json");
+		tm->addTileSheet(tileSheet);
+
+		unsigned tileWidth = tileSheet->get_spriteWidth();
+		unsigned tileHeight = tileSheet->get_spriteHeight();
+		TileLayer *layer = tm->get_layer(0);
+		std::vector<unsigned> ids(width * mapHeight, 0);
+
+		// two rows of floor and a wall at each end so nothing walks off
+		for (unsigned x = 0; x < width; x++)
+		{
+			ids[x] = groundTile;
+			ids[width + x] = groundTile;
+		}
+		for (unsigned y = 0; y < mapHeight; y++)
+		{
+			ids[y * width] = groundTile;
+			ids[y * width + width - 1] = groundTile;
+		}
+
+		// a platform or two every few columns, some of them one-way
+		std::uniform_int_distribution<int> platformCount(0, 2);
+		std::uniform_int_distribution<int> platformHeight(4, mapHeight - 6);
+		std::uniform_int_distribution<int> platformLength(3, 8);
+		std::bernoulli_distribution oneWay(0.5);
+		for (unsigned x = 4; x + 10 < width; x += 8)
+		{
+			for (int p = platformCount(rng); p > 0; p--)
+			{
+				unsigned y = platformHeight(rng);
+				unsigned length = platformLength(rng);
+				unsigned tile = oneWay(rng) ? platformTile : groundTile;
+				for (unsigned i = 0; i < length; i++)
+					ids[y * width + x + i] = tile;
+			}
+		}
+
+		for (unsigned y = 0; y < mapHeight; y++)
+		{
+			for (unsigned x = 0; x < width; x++)
+			{
+				unsigned tileID = ids[y * width + x];
+				bool solid = false;
+				bool isOneWay = false;
+				if (tileID != 0)
+				{
+					solid = tileSheet->properties.getProperty<bool>("solid", tileID - 1);
+					isOneWay = tileSheet->properties.getProperty<bool>("oneWay", tileID - 1);
+				}
+				layer->get(x, y) = Tile(tileID, Vector2(x * tileWidth, y * tileHeight),
+					solid, isOneWay, tileWidth, tileHeight, tm);
+			}
+		}
+		layer->buildMasks();
+		tm->buildCollision();
+		return tm;
+	}
+
+	Vector2 StressScene::randomPosition()
+	{
+		TileLayer *layer = loadedMap->get_layer(0);
+		SpriteSheet *tileSheet = loadedMap->get_sheets()[0];
+		std::uniform_int_distribution<int> column(2, loadedMap->get_width() - 3);
+		std::uniform_int_distribution<int> row(2, loadedMap->get_height() - 3);
+
+		// a few goes at finding open space, anything stuck in a wall just
+		// gets pushed out by its first sweep
+		int x = column(rng);
+		int y = row(rng);
+		for (int tries = 0; tries < 8 && (layer->is_solid(x, y) || layer->is_oneWay(x, y)); tries++)
+		{
+			x = column(rng);
+			y = row(rng);
+		}
+		return Vector2(x * (float)tileSheet->get_spriteWidth(), y * (float)tileSheet->get_spriteHeight());
+	}
+
+	void StressScene::spawnBullet(bool enemy)
+	{
+		std::bernoulli_distribution coin(0.5);
+		Vector2 pos = randomPosition();
+		GameObject *bullet;
+		if (enemy)
+		{
+			std::uniform_real_distribution<float> speed(-120, 120);
+			float vx = speed(rng);
+			float vy = speed(rng);
+			bullet = EnemyBullet::pool.create(pos, Vector2(vx, vy), 1);
+		}
+		else
+		{
+			bullet = PlayerBullet::pool.create(pos, coin(rng), bulletTex);
+		}
+		this->registerObject(bullet);
+		bullets.push_back(bullet->get_ID());
+	}
+
+	void StressScene::topUpBullets()
+	{
+		// bullets expire or hit something every few ticks, replace them so
+		// the count holds for the whole step
+		int live = 0;
+		for (size_t i = 0; i < bullets.size(); i++)
+		{
+			if (this->getWithID(bullets[i]) != nullptr)
+				bullets[live++] = bullets[i];
+		}
+		bullets.resize(live);
+		while ((int)bullets.size() < mix.bullets)
+			spawnBullet(bullets.size() % 2 == 1);
+	}
+
+	void StressScene::loadLevel(int levelIndex)
+	{
+		ProfileScope scope(profileLoad);
+#if LOG_LEVEL <= 0
+		StressClock::time_point loadStart = StressClock::now();
+#endif
+		this->destroyAllObjects();
+		triggers.clear();
+		bullets.clear();
+
+		if (bulletTex == nullptr)
+			bulletTex = Texture2D::create("assets/sprite/bullet.png");
+		GLContext::clearColor = Color::BLACK;
+
+		// every step starts from the seed, so a count always makes the same level
+		rng.seed(seed);
+		int entities = counts[std::min(step, (int)counts.size() - 1)];
+		mix = weights.split(entities);
+
+		delete loadedMap; // they get big, don't keep the last step's around
+		loadedMap = generateMap(entities);
+		SpriteSheet *tiles = loadedMap->get_sheets()[0];
+		triggers.bake(loadedMap->get_width(), loadedMap->get_height(),
+			tiles->get_spriteWidth(), tiles->get_spriteHeight());
+
+		Player *p = new Player(Vector2(48, 32), 12, 20, Vector2(11, 0));
+		this->registerObject(p);
+		playerID = p->get_ID();
+		p->set_invulnerable(true);
+
+		// every draw from rng goes into a local first, argument evaluation
+		// order differs between compilers and would change the layout
+		std::bernoulli_distribution hard(0.25);
+		std::bernoulli_distribution facingLeft(0.5);
+		int enemies = mix.floaters + mix.shooters + mix.bouncers + mix.robots;
+		for (int i = 0; i < enemies; i++)
+		{
+			Vector2 pos = randomPosition();
+			bool isHard = hard(rng);
+			bool left = facingLeft(rng);
+
+			GameObject *enemy;
+			if (i < mix.floaters)
+				enemy = FloaterEnemy::pool.create(pos, isHard, left);
+			else if (i < mix.floaters + mix.shooters)
+				enemy = StationaryShooter::pool.create(pos, isHard, left);
+			else if (i < mix.floaters + mix.shooters + mix.bouncers)
+				enemy = BouncingRobot::pool.create(pos, isHard, left);
+			else
+				enemy = RobotShooter::pool.create(pos, isHard, left);
+			this->registerObject(enemy);
+		}
+
+		std::bernoulli_distribution smallPowerup(0.5);
+		for (int i = 0; i < mix.powerups; i++)
+		{
+			Vector2 pos = randomPosition();
+			bool isSmall = smallPowerup(rng);
+			this->registerObject(HealthPowerup::pool.create(pos, isSmall, picojson::value()));
+		}
+
+		bullets.reserve(mix.bullets);
+		topUpBullets();
+
+		onLevelLoad();
+
+		tickMs.clear();
+		tickMs.reserve(ticksPerStep);
+		drawMs = 0;
+		draws = 0;
+
+#if LOG_LEVEL <= 0
+		LOG_MESSAGE("Generated a %ux%u stress level with %d entities in %.2f ms",
+			loadedMap->get_width(), loadedMap->get_height(), entities,
+			std::chrono::duration<double, std::milli>(StressClock::now() - loadStart).count());
+#endif
+	}
+
+	void StressScene::update(double delta)
+	{
+		StressClock::time_point start = StressClock::now();
+		topUpBullets();
+		GameScene::update(delta);
+		if (is_finished())
+			return;
+
+		tickMs.push_back(std::chrono::duration<double, std::milli>(StressClock::now() - start).count());
+		if ((int)tickMs.size() >= ticksPerStep)
+		{
+			finishStep();
+			if (is_finished())
+			{
+				if (!Settings::HEADLESS)
+					report(std::cout);
+			}
+			else
+			{
+				loadLevel(currentLevel);
+			}
+		}
+	}
+
+	void StressScene::draw()
+	{
+		StressClock::time_point start = StressClock::now();
+		GameScene::draw();
+		if (is_finished())
+			return;
+
+		drawMs += std::chrono::duration<double, std::milli>(StressClock::now() - start).count();
+		draws++;
+	}
+
+	void StressScene::finishStep()
+	{
+		StressResult r;
+		r.entities = counts[step];
+		r.objects = objects.size();
+		r.tickMs = 0;
+		r.tickMaxMs = 0;
+		for (double ms : tickMs)
+		{
+			r.tickMs += ms;
+			r.tickMaxMs = std::max(r.tickMaxMs, ms);
+		}
+		r.tickMs /= std::max((int)tickMs.size(), 1);
+		r.drawMs = draws > 0 ? drawMs / draws : 0;
+		results.push_back(r);
+
+		LOG_MESSAGE("Stress %d entities: tick %.3f ms (max %.3f), draw %.3f ms",
+			r.entities, r.tickMs, r.tickMaxMs, r.drawMs);
+		step++;
+	}
+
+	void StressScene::report(std::ostream& out) const
+	{
+		out << "stress sweep: seed " << seed << ", " << ticksPerStep << " ticks a step\n"
+			<< "  entities   objects   tick ms    max ms   draw ms\n";
+		for (const StressResult& r : results)
+		{
+			char line[80];
+			snprintf(line, sizeof(line), "  %8d  %8d  %8.3f  %8.3f  %8.3f\n",
+				r.entities, r.objects, r.tickMs, r.tickMaxMs, r.drawMs);
+			out << line;
+		}
+	}
+}
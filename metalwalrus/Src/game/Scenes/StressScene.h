@@ -0,0 +1,94 @@
+#ifndef STRESSSCENE_H
+#define STRESSSCENE_H
+#pragma once
+
+#include <ostream>
+#include <random>
+#include <vector>
+
+#include "GameScene.h"
+#include "../../Framework/Game/ObjectHandle.h"
+
+namespace metalwalrus
+{
+	// how many of each thing a stress level holds, also used as weights
+	// when a total is split between them
+	struct StressMix
+	{
+		int floaters;
+		int shooters;
+		int bouncers;
+		int robots;
+		int bullets; // topped up as they expire, half player and half enemy
+		int powerups;
+
+		int get_total() const
+		{
+			return floaters + shooters + bouncers + robots + bullets + powerups;
+		}
+
+		// share total out in proportion to these counts
+		StressMix split(int total) const;
+
+		static const StressMix defaultWeights;
+	};
+
+	struct StressResult
+	{
+		int entities;
+		int objects; // in the scene at the end of the step, with the player and enemy bullets
+		double tickMs; // mean
+		double tickMaxMs;
+		double drawMs; // mean, 0 when headless
+	};
+
+	// a generated level for finding what stops scaling. the tile map is
+	// sized to the entity count and filled from a seeded generator, then
+	// ticks and draws are timed for ticksPerStep ticks before moving on to
+	// the next count. the player can't be hurt so a step always finishes
+	class StressScene : public GameScene
+	{
+		unsigned seed;
+		std::vector<int> counts;
+		int ticksPerStep;
+		StressMix weights;
+
+		int step;
+		StressMix mix;
+		std::mt19937 rng;
+
+		Texture2D *bulletTex;
+		std::vector<ObjectHandle> bullets; // the ones this scene spawned, for topping up
+
+		std::vector<double> tickMs;
+		double drawMs;
+		int draws;
+		std::vector<StressResult> results;
+
+		TileMap *generateMap(int entities);
+		Vector2 randomPosition();
+		void spawnBullet(bool enemy);
+		void topUpBullets();
+		void finishStep();
+	public:
+		StressScene(unsigned seed, const std::vector<int>& counts, int ticksPerStep = 300,
+			const StressMix& weights = StressMix::defaultWeights);
+		~StressScene();
+
+		void update(double delta) override;
+		void draw() override;
+		void loadLevel(int levelIndex) override;
+
+		// stays on the last count once every step has been timed
+		bool is_finished() const { return step >= (int)counts.size(); }
+		const std::vector<StressResult>& get_results() const { return results; }
+		unsigned get_seed() const { return seed; }
+		int get_ticksPerStep() const { return ticksPerStep; }
+		void report(std::ostream& out) const;
+
+		// 10 to 100k, two steps a decade
+		static std::vector<int> defaultSweep();
+	};
+}
+
+#endif // STRESSSCENE_H
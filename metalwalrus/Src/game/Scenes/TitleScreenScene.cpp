@@ -4,6 +4,7 @@
 #include "../../Framework/Input/InputHandler.h"
 #include "../../Framework/Scene/SceneManager.h"
 #include "GameScene.h"
+#include "../Controls.h"
 #include "../../Framework/Graphics/GLContext.h"
 
 #include <cmath>
@@ -31,7 +32,7 @@ namespace metalwalrus
 
 	void TitleScreenScene::start()
 	{
-		AudioLocator::getAudio().playSound("assets/snd/music/selection8.ogg", true);
+		AudioLocator::getAudio().playSound("assets/snd/music/selection8.wav", true);
 		
 		this->updateable = true;
 		
@@ -50,7 +51,7 @@ namespace metalwalrus
 		t += delta;
 		drawStartText = (fmod(t, 1) < 0.5);
 
-		if (InputHandler::checkButton("shoot", ButtonState::DOWN))
+		if (InputHandler::checkButton(Controls::SHOOT, ButtonState::DOWN))
 		{
 			SceneManager::switchScene(new GameScene());
 		}
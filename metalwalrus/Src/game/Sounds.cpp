@@ -0,0 +1,24 @@
+#include "Sounds.h"
+
+#include "../Framework/Audio/AudioLocator.h"
+
+namespace metalwalrus
+{
+	SoundID Sounds::SHOOT = Audio::NO_SOUND;
+	SoundID Sounds::PLAYER_DEATH = Audio::NO_SOUND;
+	SoundID Sounds::PLAYER_LAND = Audio::NO_SOUND;
+	SoundID Sounds::PLAYER_HURT = Audio::NO_SOUND;
+	SoundID Sounds::ENEMY_HURT = Audio::NO_SOUND;
+	SoundID Sounds::GET_HEALTH = Audio::NO_SOUND;
+
+	void Sounds::load()
+	{
+		Audio& audio = AudioLocator::getAudio();
+		SHOOT = audio.loadSound("assets/snd/sfx/shoot.wav", 3);
+		PLAYER_DEATH = audio.loadSound("assets/snd/sfx/player_death.wav", 1);
+		PLAYER_LAND = audio.loadSound("assets/snd/sfx/player_land.wav", 1);
+		PLAYER_HURT = audio.loadSound("assets/snd/sfx/player_hurt.wav", 1);
+		ENEMY_HURT = audio.loadSound("assets/snd/sfx/enemy_hurt.wav", 4);
+		GET_HEALTH = audio.loadSound("assets/snd/sfx/get_health.wav", 2);
+	}
+}
@@ -0,0 +1,25 @@
+#ifndef SOUNDS_H
+#define SOUNDS_H
+#pragma once
+
+#include "../Framework/Audio/Audio.h"
+
+namespace metalwalrus
+{
+	// handles for the game's sound effects, loaded when a scene starts
+	class Sounds
+	{
+		Sounds(); // static class
+	public:
+		static SoundID SHOOT;
+		static SoundID PLAYER_DEATH;
+		static SoundID PLAYER_LAND;
+		static SoundID PLAYER_HURT;
+		static SoundID ENEMY_HURT;
+		static SoundID GET_HEALTH;
+
+		static void load();
+	};
+}
+
+#endif // SOUNDS_H
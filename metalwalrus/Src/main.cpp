@@ -3,18 +3,32 @@
 #include <GLFW/glfw3.h>
 
 #include <ctime>
+#include <cstdio>
+#include <cstdlib>
 #include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 using namespace std;
 
 #include "../resource.h"
 
 #include "Framework/Util/Debug.h"
 #include "Framework/Util/GLError.h"
+#include "Framework/Util/AllocationTracker.h"
+#include "Framework/Util/FrameArena.h"
+#include "Framework/Util/FramePacer.h"
+#include "Framework/Util/Logger.h"
 #include "Framework/Input/InputHandler.h"
+#include "Framework/Input/InputRecording.h"
 #include "Framework/Game.h"
 #include "Framework/Settings.h"
+#include "Framework/Jobs/JobSystem.h"
+#include "Framework/Scene/SceneManager.h"
 #include "game/MetalWalrus.h"
+#include "game/HeadlessRunner.h"
+#include "game/Scenes/GameScene.h"
+#include "game/Scenes/StressScene.h"
 using namespace metalwalrus;
 
 MetalWalrus *game;
@@ -22,8 +36,6 @@ GLContext *context;
 
 const double dt = 1.0 / 60.0; // 60fps in s
 double t = 0;
-double currentTime = glfwGetTime();
-double accumulator = 0;
 double cumuFramerate = 0;
 int measurements = 0;
 double avgFramerate = 0;
@@ -74,11 +86,11 @@ void changeSizeCallback(GLFWwindow *window, int w, int h)
 
 void update()
 {
-	double newTime = glfwGetTime();
-	double frameTime = newTime - currentTime;
-	currentTime = newTime;
+	// events once per frame, every tick this frame sees the same keys
+	glfwPollEvents();
 
-	accumulator += frameTime;
+	int steps = FramePacer::beginFrame();
+	double frameTime = FramePacer::get_frameTime();
 
 	Debug::frameTime = frameTime;
 	Debug::fps = 1.0 / frameTime;
@@ -86,15 +98,15 @@ void update()
 	measurements++;
 	avgFramerate = cumuFramerate / (double)measurements;
 
-	while (accumulator >= dt)
+	for (int i = 0; i < steps; i++)
 	{
-		glfwPollEvents();
-
 		InputHandler::handleInput();
 		
 		game->update(dt);
 
-		accumulator -= dt;
+		if (InputRecording::is_active())
+			InputRecording::endTick(SceneManager::hashState());
+
 		t += dt;
 	}
 }
@@ -120,11 +132,124 @@ void draw()
 // https://learnopengl.com/code_viewer.php?code=getting-started/hellowindow2
 int main(int argc, char **argv)
 {
+	// --threads N sets the job system's thread count, 0 (default) uses every core
+	// --headless runs --ticks N fixed ticks of --level N without a window
+	// --record path saves every tick's input, --replay path plays it back
+	// --vsync N sets the swap interval, --fps N caps the frame rate (on by
+	// default when vsync is off), --max-steps N limits catch-up ticks per
+	// frame and --interpolate draws between the last two ticks
+	// --mixer path.wav|null swaps irrKlang for the software mixer
+	// --alloc-budget N fails a headless run if a tick after the first
+	// --alloc-warmup N (default 60) allocates more than N times
+	// --stress N plays a generated level with N entities, --stress-sweep
+	// times counts from 10 to 100k. --stress-ticks N per count (default
+	// 300), --stress-seed N and --stress-mix f,s,b,r,bullets,powerups to
+	// weight the floaters, shooters, bouncing robots and robot shooters
+	int threads = 0;
+	bool headless = false;
+	int level = 0;
+	int ticks = 3600;
+	std::string recordPath;
+	std::string replayPath;
+	std::string mixerOutput;
+	int fps = -1;
+	int allocBudget = -1;
+	int allocWarmup = 60;
+	std::vector<int> stressCounts;
+	int stressTicks = 300;
+	unsigned stressSeed = 1;
+	StressMix stressMix = StressMix::defaultWeights;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--headless")
+			headless = true;
+		else if (arg == "--threads" && i + 1 < argc)
+			threads = std::stoi(argv[++i]);
+		else if (arg == "--level" && i + 1 < argc)
+			level = std::stoi(argv[++i]);
+		else if (arg == "--ticks" && i + 1 < argc)
+			ticks = std::stoi(argv[++i]);
+		else if (arg == "--record" && i + 1 < argc)
+			recordPath = argv[++i];
+		else if (arg == "--replay" && i + 1 < argc)
+			replayPath = argv[++i];
+		else if (arg == "--vsync" && i + 1 < argc)
+			FramePacer::set_swapInterval(std::stoi(argv[++i]));
+		else if (arg == "--fps" && i + 1 < argc)
+			fps = std::stoi(argv[++i]);
+		else if (arg == "--max-steps" && i + 1 < argc)
+			FramePacer::set_maxSteps(std::max(1, std::stoi(argv[++i])));
+		else if (arg == "--interpolate")
+			FramePacer::set_interpolate(true);
+		else if (arg == "--mixer" && i + 1 < argc)
+			mixerOutput = argv[++i];
+		else if (arg == "--alloc-budget" && i + 1 < argc)
+			allocBudget = std::stoi(argv[++i]);
+		else if (arg == "--alloc-warmup" && i + 1 < argc)
+			allocWarmup = std::stoi(argv[++i]);
+		else if (arg == "--stress" && i + 1 < argc)
+			stressCounts.assign(1, std::stoi(argv[++i]));
+		else if (arg == "--stress-sweep")
+			stressCounts = StressScene::defaultSweep();
+		else if (arg == "--stress-ticks" && i + 1 < argc)
+			stressTicks = std::stoi(argv[++i]);
+		else if (arg == "--stress-seed" && i + 1 < argc)
+			stressSeed = (unsigned)std::stoul(argv[++i]);
+		else if (arg == "--stress-mix" && i + 1 < argc)
+		{
+			StressMix m;
+			if (sscanf(argv[++i], "%d,%d,%d,%d,%d,%d", &m.floaters, &m.shooters,
+				&m.bouncers, &m.robots, &m.bullets, &m.powerups) != 6)
+			{
+				LOG_WARNING("--stress-mix needs six comma separated counts, using the default");
+			}
+			else if (m.get_total() <= 0 || std::min({ m.floaters, m.shooters, m.bouncers,
+				m.robots, m.bullets, m.powerups }) < 0)
+			{
+				// would split every count into nothing and time an empty level
+				LOG_ERROR("--stress-mix needs at least one positive count and none negative");
+				return -1;
+			}
+			else
+				stressMix = m;
+		}
+	}
+
+	if (headless)
+	{
+		Logger::start();
+		JobSystem::start(threads);
+		HeadlessRunner::set_allocBudget(allocBudget, allocWarmup);
+		int result;
+		if (!stressCounts.empty())
+			result = HeadlessRunner::stress(stressCounts, stressTicks, stressSeed, stressMix);
+		else if (!replayPath.empty())
+			result = HeadlessRunner::replay(replayPath);
+		else
+			result = HeadlessRunner::run(level, ticks, recordPath);
+		JobSystem::stop();
+		Logger::stop();
+		return result;
+	}
+
+	// the seed goes into recordings so a replay rolls the same drops
+	unsigned seed = (unsigned)time(nullptr);
+	if (!replayPath.empty())
+	{
+		if (!InputRecording::startReplay(replayPath))
+			return -1;
+		seed = InputRecording::get_seed();
+	}
+	srand(seed);
+
 	Debug::redirect("log.txt");
+	Logger::start();
 
 	context = new GLContext();
 
 	game = new MetalWalrus("Metal Walrus", Settings::TARGET_WIDTH, Settings::TARGET_HEIGHT, context);
+	game->mixerOutput = mixerOutput;
 
 	glfwInit();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -136,11 +261,13 @@ int main(int argc, char **argv)
 		game->getTitle(), nullptr, nullptr);
 	if (window == nullptr)
 	{
-		std::cerr << "Failed to create GLFW window" << std::endl;
+		LOG_FATAL("Failed to create GLFW window");
 		glfwTerminate();
+		Logger::stop();
 		return -1;
 	}
 	glfwMakeContextCurrent(window);
+	glfwSwapInterval(FramePacer::get_swapInterval());
 
 	// Set the required callback functions
 	glfwSetKeyCallback(window, key_callback);
@@ -148,7 +275,8 @@ int main(int argc, char **argv)
 	glewExperimental = GL_TRUE;
 	if (glewInit() != GLEW_OK)
 	{
-		std::cout << "Failed to initialize GLEW" << std::endl;
+		LOG_FATAL("Failed to initialize GLEW");
+		Logger::stop();
 		return -1;
 	}
 
@@ -156,8 +284,27 @@ int main(int argc, char **argv)
 	glfwSetWindowSizeCallback(window, changeSizeCallback);
 	changeSizeCallback(window, Settings::TARGET_WIDTH, Settings::TARGET_HEIGHT);
 
+	JobSystem::start(threads);
 	game->start();
 
+	// the game always starts on the title screen, which recordings call level -1
+	if (InputRecording::is_replaying())
+	{
+		if (InputRecording::get_startLevel() >= 0)
+			SceneManager::switchScene(new GameScene(InputRecording::get_startLevel()));
+	}
+	else if (!stressCounts.empty())
+		SceneManager::switchScene(new StressScene(stressSeed, stressCounts, stressTicks, stressMix));
+	else if (!recordPath.empty())
+		InputRecording::startRecording(recordPath, InputHandler::get_inputCount(), seed, -1);
+
+	// without vsync nothing else stops the loop spinning a whole core
+	if (fps < 0)
+		fps = FramePacer::get_swapInterval() > 0 ? 0 : 60;
+	FramePacer::set_tickLength(dt);
+	FramePacer::set_targetFps(fps);
+	FramePacer::reset();
+
 	// Game loop
 	while (!glfwWindowShouldClose(window))
 	{
@@ -166,11 +313,19 @@ int main(int argc, char **argv)
 		draw();
 
 		glfwSwapBuffers(window);
+		FrameArena::reset(); // nothing from the frame arena outlives the frame
+		AllocationTracker::endFrame();
+
+		FramePacer::endFrame();
 	}
 
+	InputRecording::save();
+
 	// Terminate GLFW, clearing any resources allocated by GLFW.
 	glfwTerminate();
 	delete game;
 	delete context;
+	JobSystem::stop();
+	Logger::stop();
 	return 0;
 }
\ No newline at end of file
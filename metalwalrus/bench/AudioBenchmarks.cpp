@@ -0,0 +1,45 @@
+#include "Benchmark.h"
+
+#include "../Src/Framework/Audio/MixerAudio.h"
+
+// one iteration mixes one block of 256 frames, 5.8 ms of audio at 44.1 kHz,
+// so 58000 ns a block is 1% of a core
+
+namespace metalwalrus
+{
+	static MixerAudio *busyMixer(int voices)
+	{
+		const char *sounds[] = { "assets/snd/sfx/shoot.wav", "assets/snd/sfx/player_death.wav" };
+		MixerAudio *mixer = new MixerAudio(new NullSink());
+		for (int i = 0; i < voices; i++)
+			mixer->playSound(sounds[i % 2], true); // looping so every voice stays busy
+		return mixer;
+	}
+
+	static void mixBlocks(MixerAudio *mixer, int iterations)
+	{
+		for (int i = 0; i < iterations; i++)
+			mixer->mixBlock();
+		Benchmark::keep(mixer->get_activeVoices());
+	}
+
+	static const int mix1 = Benchmark::add("audio.mixer block 1 voice", [](int iterations) {
+		static MixerAudio *mixer = busyMixer(1);
+		mixBlocks(mixer, iterations);
+	});
+
+	static const int mix16 = Benchmark::add("audio.mixer block 16 voices", [](int iterations) {
+		static MixerAudio *mixer = busyMixer(16);
+		mixBlocks(mixer, iterations);
+	});
+
+	static const int mix64 = Benchmark::add("audio.mixer block 64 voices", [](int iterations) {
+		static MixerAudio *mixer = busyMixer(64);
+		mixBlocks(mixer, iterations);
+	});
+
+	static const int mix128 = Benchmark::add("audio.mixer block 128 voices", [](int iterations) {
+		static MixerAudio *mixer = busyMixer(128);
+		mixBlocks(mixer, iterations);
+	});
+}
@@ -0,0 +1,149 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+namespace metalwalrus
+{
+	typedef std::chrono::high_resolution_clock BenchClock;
+
+	std::vector<Benchmark::Result> Benchmark::results;
+	volatile char Benchmark::sink;
+
+	std::vector<Benchmark::Entry>& Benchmark::entries()
+	{
+		// function-local so benchmarks can register during static initialization
+		static std::vector<Entry> allEntries;
+		return allEntries;
+	}
+
+	std::vector<Benchmark::Check>& Benchmark::checks()
+	{
+		static std::vector<Check> allChecks;
+		return allChecks;
+	}
+
+	int Benchmark::add(const std::string& name, BenchmarkBody body)
+	{
+		Entry e = { name, body };
+		entries().push_back(e);
+		return entries().size() - 1;
+	}
+
+	int Benchmark::addCheck(const std::string& name, CheckBody body)
+	{
+		Check c = { name, body };
+		checks().push_back(c);
+		return checks().size() - 1;
+	}
+
+	static double timeMs(const BenchmarkBody& body, long long iterations)
+	{
+		BenchClock::time_point start = BenchClock::now();
+		body((int)iterations);
+		return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+	}
+
+	void Benchmark::runAll(const std::string& filter, double minSampleMs, int samples)
+	{
+		std::vector<Entry> sorted = entries();
+		std::sort(sorted.begin(), sorted.end(),
+			[](const Entry& a, const Entry& b) { return a.name < b.name; });
+
+		for (auto& e : sorted)
+		{
+			if (e.name.find(filter) == std::string::npos)
+				continue;
+
+			// grow the iteration count until one sample takes minSampleMs,
+			// the first call also does the benchmark's setup
+			long long iterations = 1;
+			double ms = timeMs(e.body, iterations);
+			while (ms < minSampleMs && iterations < (1 << 30))
+			{
+				double scale = ms > 0 ? minSampleMs / ms * 1.2 : 10;
+				iterations = (long long)(iterations * std::min(std::max(scale, 2.0), 10.0));
+				ms = timeMs(e.body, iterations);
+			}
+
+			std::vector<double> nsPerIteration;
+			for (int i = 0; i < samples; i++)
+				nsPerIteration.push_back(timeMs(e.body, iterations) * 1e6 / iterations);
+			std::sort(nsPerIteration.begin(), nsPerIteration.end());
+
+			Result r = { e.name, nsPerIteration[nsPerIteration.size() / 2], nsPerIteration[0], iterations };
+			results.push_back(r);
+
+			char line[160];
+			snprintf(line, sizeof(line), "  %-48s %12.1f ns (min %.1f, %lld its)",
+				r.name.c_str(), r.medianNs, r.minNs, r.iterations);
+			std::cout << line << std::endl;
+		}
+	}
+
+	int Benchmark::runChecks(const std::string& filter)
+	{
+		int failed = 0;
+		for (auto& c : checks())
+		{
+			if (c.name.find(filter) == std::string::npos)
+				continue;
+
+			bool passed = c.body();
+			if (!passed)
+				failed++;
+
+			char line[160];
+			snprintf(line, sizeof(line), "  %-48s %12s", c.name.c_str(), passed ? "ok" : "FAILED");
+			std::cout << line << std::endl;
+		}
+		return failed;
+	}
+
+	void Benchmark::list()
+	{
+		for (auto& e : entries())
+			std::cout << e.name << "\n";
+		for (auto& c : checks())
+			std::cout << c.name << " (check)\n";
+	}
+
+	static std::string escape(const std::string& text)
+	{
+		std::string escaped;
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+
+	bool Benchmark::writeJSON(const std::string& path)
+	{
+		FILE *out = fopen(path.c_str(), "w");
+		if (out == nullptr)
+			return false;
+
+		// one benchmark a line, tenths of a nanosecond are well under the noise
+		fprintf(out, "{\n");
+#ifdef _DEBUG
+		fprintf(out, "  \"build\": \"debug\",\n");
+#else
+		fprintf(out, "  \"build\": \"release\",\n");
+#endif
+		fprintf(out, "  \"benchmarks\": [\n");
+		for (int i = 0; i < results.size(); i++)
+		{
+			const Result& r = results[i];
+			fprintf(out, "    { \"name\": \"%s\", \"median_ns\": %.1f, \"min_ns\": %.1f, \"iterations\": %lld }%s\n",
+				escape(r.name).c_str(), r.medianNs, r.minNs, r.iterations,
+				i + 1 < results.size() ? "," : "");
+		}
+		fprintf(out, "  ]\n}\n");
+		return fclose(out) == 0;
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace metalwalrus
+{
+	// a benchmark body runs its operation the given number of times, any
+	// setup it needs goes in function-local statics so it isn't timed twice
+	typedef std::function<void(int iterations)> BenchmarkBody;
+	// a check compares a fast path against a slow reference, returning
+	// false (after logging why) if they disagree
+	typedef std::function<bool()> CheckBody;
+
+	// registry and runner for the microbenchmarks. each one is calibrated
+	// until a sample takes long enough to trust, then timed over several
+	// samples and reported as ns per iteration
+	class Benchmark
+	{
+		struct Entry
+		{
+			std::string name; // "group.what it does"
+			BenchmarkBody body;
+		};
+
+		struct Result
+		{
+			std::string name;
+			double medianNs;
+			double minNs;
+			long long iterations; // per sample
+		};
+
+		struct Check
+		{
+			std::string name;
+			CheckBody body;
+		};
+
+		static std::vector<Entry>& entries();
+		static std::vector<Check>& checks();
+		static std::vector<Result> results;
+
+		static volatile char sink;
+
+		Benchmark(); // static class
+	public:
+		// returns the index, meant for file-scope registration
+		static int add(const std::string& name, BenchmarkBody body);
+		static int addCheck(const std::string& name, CheckBody body);
+
+		// runs every benchmark whose name contains filter
+		static void runAll(const std::string& filter, double minSampleMs, int samples);
+		// runs every check whose name contains filter, returns how many failed
+		static int runChecks(const std::string& filter);
+		static void list();
+		// sorted by name so results from two commits diff line by line
+		static bool writeJSON(const std::string& path);
+
+		// stops the compiler from throwing away work whose result is unused
+		template <typename T>
+		static void keep(const T& value)
+		{
+			sink = *reinterpret_cast<const volatile char*>(&value);
+		}
+	};
+}
+
+#endif // BENCHMARK_H
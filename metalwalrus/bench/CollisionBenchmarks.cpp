@@ -0,0 +1,223 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../Src/Framework/Game/SolidObject.h"
+#include "../Src/Framework/Graphics/Camera.h"
+#include "../Src/Framework/Graphics/TileMap.h"
+#include "../Src/Framework/Physics/AABB.h"
+#include "../Src/Framework/Physics/TriggerIndex.h"
+#include "../Src/Framework/Scene/IScene.h"
+#include "../Src/Framework/Util/Debug.h"
+#include "../Src/Framework/Util/JSONUtil.h"
+
+namespace metalwalrus
+{
+	static std::vector<AABB>& boxes()
+	{
+		static std::vector<AABB> b;
+		if (b.empty())
+		{
+			for (int i = 0; i < 1024; i++)
+			{
+				Vector2 min = Vector2((float)((i * 37) % 512), (float)((i * 91) % 256));
+				b.push_back(AABB(min, min + Vector2(16, 24)));
+			}
+		}
+		return b;
+	}
+
+	static TileMap *benchMap()
+	{
+		static Camera camera;
+		static TileMap *map = utilities::JSONUtil::tiled_tilemap("assets/data/level/level1.json", &camera);
+		return map;
+	}
+
+	static const int aabbIntersects = Benchmark::add("collision.aabb intersects 1024 pairs", [](int iterations) {
+		std::vector<AABB>& b = boxes();
+		for (int i = 0; i < iterations; i++)
+		{
+			int hits = 0;
+			for (int j = 0; j < b.size(); j++)
+			{
+				if (b[j].intersects(b[(j * 7 + 1) % b.size()]))
+					hits++;
+			}
+			Benchmark::keep(hits);
+		}
+	});
+
+	static const int tileCollides = Benchmark::add("collision.tilemap boundingBoxCollides 1024 boxes", [](int iterations) {
+		TileMap *map = benchMap();
+		std::vector<AABB>& b = boxes();
+		AABB tileBox;
+		Tile tile;
+		for (int i = 0; i < iterations; i++)
+		{
+			int hits = 0;
+			for (auto& box : b)
+			{
+				if (map->boundingBoxCollides(box, tileBox, tile))
+					hits++;
+			}
+			Benchmark::keep(hits);
+		}
+	});
+
+	static const int tileSweep = Benchmark::add("collision.tilemap sweepX sweepY 1024 boxes", [](int iterations) {
+		TileMap *map = benchMap();
+		std::vector<AABB>& b = boxes();
+		TileSweep sweep;
+		for (int i = 0; i < iterations; i++)
+		{
+			float total = 0;
+			for (auto& box : b)
+			{
+				map->sweepX(box, 4, sweep);
+				total += sweep.distance;
+				map->sweepY(box, -6, sweep);
+				total += sweep.distance;
+			}
+			Benchmark::keep(total);
+		}
+	});
+
+	// owns the bodies in the broadphase check
+	class BroadPhaseScene : public IScene
+	{
+	public:
+		void start() override { }
+		void update(double delta) override { }
+		void draw() override { }
+	};
+
+	static AABB randomBox(std::mt19937& rng, float worldSize, float maxSize)
+	{
+		std::uniform_real_distribution<float> coord(-64, worldSize);
+		std::uniform_real_distribution<float> size(1, maxSize);
+		float x = coord(rng);
+		float y = coord(rng);
+		float w = size(rng);
+		float h = size(rng);
+		return AABB(Vector2(x, y), Vector2(x + w, y + h));
+	}
+
+	// the hashed grid has to return exactly what scanning every live body
+	// would, after bodies have moved across cells and some were destroyed
+	static const int broadPhaseMatches = Benchmark::addCheck("collision.broadphase query matches all-pairs scan", []() {
+		std::mt19937 rng(1234);
+		std::uniform_real_distribution<float> step(-48, 48);
+		std::uniform_int_distribution<unsigned> mask(1, 15);
+
+		BroadPhaseScene scene;
+		std::vector<SolidObject*> bodies;
+		for (int i = 0; i < 2000; i++)
+		{
+			AABB box = randomBox(rng, 2048, 40);
+			SolidObject *body = new SolidObject(box.get_min(), box.get_width(), box.get_height());
+			body->set_collisionLayer(1u << (i % 4));
+			scene.registerObject(body);
+			bodies.push_back(body);
+		}
+		for (int i = 0; i < (int)bodies.size(); i += 2)
+		{
+			float dx = step(rng);
+			float dy = step(rng);
+			bodies[i]->moveBy(Vector2(dx, dy));
+		}
+		std::vector<SolidObject*> live;
+		for (int i = 0; i < (int)bodies.size(); i++)
+		{
+			if (i % 7 == 0)
+				scene.destroyObject(bodies[i]);
+			else
+				live.push_back(bodies[i]);
+		}
+
+		int mismatched = 0;
+		std::vector<SolidObject*> found, expected;
+		for (int q = 0; q < 500; q++)
+		{
+			AABB box = randomBox(rng, 2048, 200);
+			unsigned queryMask = mask(rng);
+
+			found.clear();
+			scene.get_broadPhase().query(box, queryMask, found);
+			expected.clear();
+			for (auto body : live)
+			{
+				if ((body->get_collisionLayer() & queryMask) != 0 && box.intersects(body->get_boundingBox()))
+					expected.push_back(body);
+			}
+
+			std::sort(found.begin(), found.end());
+			std::sort(expected.begin(), expected.end());
+			if (found != expected)
+				mismatched++;
+		}
+
+		if (mismatched != 0)
+			LOG_ERROR("%d of 500 broadphase queries differ from the all-pairs scan", mismatched);
+		return mismatched == 0;
+	});
+
+	// the baked trigger grid against scanning every trigger, including ones
+	// hanging off the map that get clamped into the edge cells
+	static const int triggerIndexMatches = Benchmark::addCheck("collision.trigger index matches brute-force scan", []() {
+		const int width = 64, height = 32;
+		const float tile = 16;
+		std::mt19937 rng(4321);
+		std::uniform_int_distribution<unsigned> typeBit(0, 3);
+		std::uniform_int_distribution<unsigned> mask(1, 15);
+
+		std::vector<SolidObject*> triggers;
+		std::vector<unsigned> types;
+		TriggerIndex index;
+		for (int i = 0; i < 300; i++)
+		{
+			AABB box = randomBox(rng, width * tile, 96);
+			unsigned type = 1u << typeBit(rng);
+			SolidObject *trigger = new SolidObject(box.get_min(), box.get_width(), box.get_height());
+			index.add(trigger, type);
+			triggers.push_back(trigger);
+			types.push_back(type);
+		}
+		index.bake(width, height, tile, tile);
+
+		int mismatched = 0;
+		std::vector<SolidObject*> found, expected;
+		for (int q = 0; q < 500; q++)
+		{
+			AABB box = randomBox(rng, width * tile, 64);
+			unsigned queryMask = mask(rng);
+
+			found.clear();
+			index.query(box, queryMask, found);
+			expected.clear();
+			unsigned expectedTypes = 0;
+			for (int i = 0; i < (int)triggers.size(); i++)
+			{
+				if (!box.intersects(triggers[i]->get_boundingBox()))
+					continue;
+				expectedTypes |= types[i];
+				if ((types[i] & queryMask) != 0)
+					expected.push_back(triggers[i]);
+			}
+
+			std::sort(found.begin(), found.end());
+			std::sort(expected.begin(), expected.end());
+			if (found != expected || index.queryTypes(box) != expectedTypes)
+				mismatched++;
+		}
+
+		for (auto t : triggers)
+			delete t;
+
+		if (mismatched != 0)
+			LOG_ERROR("%d of 500 trigger index queries differ from the brute-force scan", mismatched);
+		return mismatched == 0;
+	});
+}
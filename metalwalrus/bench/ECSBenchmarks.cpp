@@ -0,0 +1,219 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "../Src/Framework/ECS/EntityWorld.h"
+#include "../Src/Framework/ECS/ObjectBridge.h"
+#include "../Src/Framework/ECS/Systems.h"
+#include "../Src/Framework/Game/SolidObject.h"
+#include "../Src/Framework/Graphics/SpriteBatch.h"
+#include "../Src/Framework/Graphics/Texture2D.h"
+#include "../Src/Framework/Graphics/TextureRegion.h"
+#include "../Src/Framework/Scene/IScene.h"
+#include "../Src/Framework/Util/Debug.h"
+
+// the component passes against the same data behind SolidObject pointers,
+// every benchmark gets its own world so one can't move the others' entities
+
+namespace metalwalrus
+{
+	static const int ecsEntities = 10000;
+	static const double ecsDelta = 1.0 / 60.0;
+	static const float ecsWorldSize = 4096;
+
+	static float randomRange(float min, float max)
+	{
+		return min + (max - min) * (rand() / (float)RAND_MAX);
+	}
+
+	static TextureRegion *ecsSprite()
+	{
+		static Texture2D *tex = Texture2D::create(64, 64);
+		static TextureRegion region(tex, 0, 0, 8, 8);
+		return &region;
+	}
+
+	static void fillWorld(EntityWorld& world)
+	{
+		srand(1234);
+		for (int i = 0; i < ecsEntities; i++)
+		{
+			EntityID e = world.create();
+			Transform t = { Vector2(randomRange(0, ecsWorldSize), randomRange(0, ecsWorldSize)) };
+			Velocity v = { Vector2(randomRange(-60, 60), randomRange(-60, 60)) };
+			Collider c = { Vector2::ZERO, 8, 8, 1u << (i % 2), 0, 0, 0, 0 };
+			world.transforms.add(e.index, t);
+			world.velocities.add(e.index, v);
+			world.colliders.add(e.index, c);
+			Sprite s = { ecsSprite(), i % 2 == 0 };
+			world.sprites.add(e.index, s);
+		}
+		Systems::updateColliders(world);
+	}
+
+	// the same positions and velocities fillWorld makes, as SolidObjects
+	static void fillObjects(std::vector<SolidObject*>& objects, std::vector<Vector2>& velocities)
+	{
+		srand(1234);
+		for (int i = 0; i < ecsEntities; i++)
+		{
+			Vector2 pos = Vector2(randomRange(0, ecsWorldSize), randomRange(0, ecsWorldSize));
+			objects.push_back(new SolidObject(pos, 8, 8));
+			velocities.push_back(Vector2(randomRange(-60, 60), randomRange(-60, 60)));
+		}
+	}
+
+	// owns the objects the bridge tracks, nothing else
+	class BridgeScene : public IScene
+	{
+	public:
+		void start() override { }
+		void update(double delta) override { }
+		void draw() override { }
+	};
+
+	// the objects registered with a scene and tracked by a bridge, velocities
+	// go into the bridge's world
+	struct BridgedObjects
+	{
+		BridgeScene scene;
+		EntityWorld world;
+		ObjectBridge bridge;
+		std::vector<SolidObject*> objects;
+
+		BridgedObjects() : bridge(world, scene)
+		{
+			srand(1234);
+			for (int i = 0; i < ecsEntities; i++)
+			{
+				Vector2 pos = Vector2(randomRange(0, ecsWorldSize), randomRange(0, ecsWorldSize));
+				SolidObject *obj = new SolidObject(pos, 8, 8);
+				scene.registerObject(obj);
+				EntityID e = bridge.track(obj);
+				Velocity v = { Vector2(randomRange(-60, 60), randomRange(-60, 60)) };
+				world.velocities.add(e.index, v);
+				objects.push_back(obj);
+			}
+		}
+
+		void tick()
+		{
+			bridge.pushToWorld();
+			Systems::integrate(world, ecsDelta);
+			Systems::updateColliders(world);
+			bridge.pullFromWorld();
+		}
+	};
+
+	static const int ecsIntegrate = Benchmark::add("ecs.integrate 10000 entities", [](int iterations) {
+		static EntityWorld world;
+		if (world.get_aliveCount() == 0)
+			fillWorld(world);
+		for (int i = 0; i < iterations; i++)
+			Systems::integrate(world, ecsDelta);
+		Benchmark::keep(world.transforms.size());
+	});
+
+	static const int ecsColliders = Benchmark::add("ecs.update colliders 10000 entities", [](int iterations) {
+		static EntityWorld world;
+		if (world.get_aliveCount() == 0)
+			fillWorld(world);
+		for (int i = 0; i < iterations; i++)
+			Systems::updateColliders(world);
+		Benchmark::keep(world.colliders.size());
+	});
+
+	static const int ecsCollide = Benchmark::add("ecs.collide 10000 entities", [](int iterations) {
+		static EntityWorld world;
+		static std::vector<EntityPair> pairs;
+		if (world.get_aliveCount() == 0)
+			fillWorld(world);
+		for (int i = 0; i < iterations; i++)
+		{
+			Systems::collide(world, pairs);
+			Benchmark::keep(pairs.size());
+		}
+	});
+
+	static const int ecsDraw = Benchmark::add("ecs.draw 10000 sprites", [](int iterations) {
+		static EntityWorld world;
+		static SpriteBatch batch;
+		if (world.get_aliveCount() == 0)
+			fillWorld(world);
+		for (int i = 0; i < iterations; i++)
+		{
+			batch.begin();
+			Systems::draw(world, batch);
+			batch.end();
+			Benchmark::keep(batch.renderCalls);
+		}
+	});
+
+	static const int objectMoveBy = Benchmark::add("ecs.SolidObject moveBy 10000 objects", [](int iterations) {
+		static std::vector<SolidObject*> objects;
+		static std::vector<Vector2> velocities;
+		if (objects.empty())
+			fillObjects(objects, velocities);
+		for (int i = 0; i < iterations; i++)
+		{
+			for (size_t j = 0; j < objects.size(); j++)
+				objects[j]->moveBy(velocities[j] * ecsDelta);
+		}
+		Benchmark::keep(objects[0]->get_position());
+	});
+
+	static const int bridgeTick = Benchmark::add("ecs.ObjectBridge push systems pull 10000 objects", [](int iterations) {
+		static BridgedObjects bridged;
+		for (int i = 0; i < iterations; i++)
+			bridged.tick();
+		Benchmark::keep(bridged.objects[0]->get_position());
+	});
+
+	// objects moved by the systems through ObjectBridge have to end up
+	// exactly where moveBy puts them, and untracked or destroyed objects
+	// have to lose their links on the next sync
+	static const int bridgeMatches = Benchmark::addCheck("ecs.ObjectBridge matches SolidObject moveBy", []() {
+		const int ticks = 600;
+
+		std::vector<SolidObject*> objects;
+		std::vector<Vector2> velocities;
+		fillObjects(objects, velocities);
+		for (int i = 0; i < ticks; i++)
+		{
+			for (size_t j = 0; j < objects.size(); j++)
+				objects[j]->moveBy(velocities[j] * ecsDelta);
+		}
+
+		BridgedObjects bridged;
+		for (int i = 0; i < ticks; i++)
+			bridged.tick();
+
+		int mismatched = 0;
+		for (int i = 0; i < ecsEntities; i++)
+		{
+			Vector2 a = bridged.objects[i]->get_position();
+			Vector2 b = objects[i]->get_position();
+			AABB boxA = bridged.objects[i]->get_boundingBox();
+			AABB boxB = objects[i]->get_boundingBox();
+			if (a.x != b.x || a.y != b.y
+				|| boxA.get_left() != boxB.get_left() || boxA.get_bottom() != boxB.get_bottom())
+				mismatched++;
+		}
+		for (auto o : objects)
+			delete o;
+
+		bridged.bridge.untrack(bridged.objects[0]);
+		bridged.scene.destroyObject(bridged.objects[1]);
+		bridged.bridge.pushToWorld();
+		int expectedLinks = ecsEntities - 2;
+
+		if (mismatched != 0)
+			LOG_ERROR("%d bridged objects are off the moveBy walk", mismatched);
+		if (bridged.bridge.get_linkCount() != expectedLinks)
+			LOG_ERROR("%d bridge links after untrack and destroy, expected %d",
+				bridged.bridge.get_linkCount(), expectedLinks);
+		return mismatched == 0 && bridged.bridge.get_linkCount() == expectedLinks;
+	});
+}
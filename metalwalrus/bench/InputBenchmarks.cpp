@@ -0,0 +1,59 @@
+#include "Benchmark.h"
+
+#include "../Src/Framework/Input/InputHandler.h"
+
+namespace metalwalrus
+{
+	static const char *inputNames[] = { "left", "right", "up", "down", "jump", "shoot" };
+
+	static void addInputs()
+	{
+		static bool added = false;
+		if (added)
+			return;
+		int codes[] = { GLFW_KEY_LEFT, GLFW_KEY_RIGHT, GLFW_KEY_UP, GLFW_KEY_DOWN, GLFW_KEY_Z, GLFW_KEY_X };
+		for (int i = 0; i < 6; i++)
+			InputHandler::addInput(inputNames[i], codes[i]);
+		added = true;
+	}
+
+	static const int checkByName = Benchmark::add("input.checkButton by name x6", [](int iterations) {
+		addInputs();
+		for (int i = 0; i < iterations; i++)
+		{
+			int held = 0;
+			for (auto name : inputNames)
+			{
+				if (InputHandler::checkButton(name, ButtonState::HELD))
+					held++;
+			}
+			Benchmark::keep(held);
+		}
+	});
+
+	static const int checkByID = Benchmark::add("input.checkButton by id x6", [](int iterations) {
+		addInputs();
+		InputID ids[6];
+		for (int i = 0; i < 6; i++)
+			ids[i] = InputHandler::get_inputID(inputNames[i]);
+		for (int i = 0; i < iterations; i++)
+		{
+			int held = 0;
+			for (auto id : ids)
+			{
+				if (InputHandler::checkButton(id, ButtonState::HELD))
+					held++;
+			}
+			Benchmark::keep(held);
+		}
+	});
+
+	static const int handleInput = Benchmark::add("input.handleInput", [](int iterations) {
+		addInputs();
+		for (int i = 0; i < iterations; i++)
+		{
+			InputHandler::updateKeys(GLFW_KEY_Z, i & 1);
+			InputHandler::handleInput();
+		}
+	});
+}
@@ -0,0 +1,63 @@
+#include "Benchmark.h"
+
+#include <lodepng.h>
+
+#include "../Src/Framework/Graphics/Camera.h"
+#include "../Src/Framework/Graphics/TileMap.h"
+#include "../Src/Framework/Util/JSONUtil.h"
+
+namespace metalwalrus
+{
+	// one benchmark per shipped level, test.json is only used in development
+	static void loadLevel(const std::string& file, int iterations)
+	{
+		static Camera camera;
+		for (int i = 0; i < iterations; i++)
+		{
+			TileMap *map = utilities::JSONUtil::tiled_tilemap("assets/data/level/" + file, &camera);
+			Benchmark::keep(map);
+			delete map;
+		}
+	}
+
+	static const int level1 = Benchmark::add("loading.tiled_tilemap level1", [](int iterations) {
+		loadLevel("level1.json", iterations);
+	});
+
+	static const int level2 = Benchmark::add("loading.tiled_tilemap level2", [](int iterations) {
+		loadLevel("level2.json", iterations);
+	});
+
+	static const int level3 = Benchmark::add("loading.tiled_tilemap level3", [](int iterations) {
+		loadLevel("level3.json", iterations);
+	});
+
+	static void decodePNG(const char *path, int iterations)
+	{
+		// the file is read once, only the decode is timed
+		static std::vector<unsigned char> file;
+		static const char *loaded = nullptr;
+		if (loaded != path)
+		{
+			file.clear();
+			lodepng::load_file(file, path);
+			loaded = path;
+		}
+		std::vector<unsigned char> image;
+		unsigned width, height;
+		for (int i = 0; i < iterations; i++)
+		{
+			image.clear();
+			lodepng::decode(image, width, height, file);
+			Benchmark::keep(width);
+		}
+	}
+
+	static const int pngWalrus = Benchmark::add("loading.png decode walrus", [](int iterations) {
+		decodePNG("assets/sprite/walrus.png", iterations);
+	});
+
+	static const int pngTiles = Benchmark::add("loading.png decode tileset", [](int iterations) {
+		decodePNG("assets/tile/0001.png", iterations);
+	});
+}
@@ -0,0 +1,82 @@
+#include "Benchmark.h"
+
+#include <vector>
+
+#include "../Src/Framework/Math/Matrix3.h"
+#include "../Src/Framework/Math/Vector2.h"
+
+namespace metalwalrus
+{
+	static std::vector<Vector2>& points()
+	{
+		static std::vector<Vector2> p;
+		if (p.empty())
+		{
+			for (int i = 0; i < 1024; i++)
+				p.push_back(Vector2((float)(i % 37) - 18, (float)(i % 23) * 0.5f + 1));
+		}
+		return p;
+	}
+
+	static const int vectorAdd = Benchmark::add("math.vector2 add x1024", [](int iterations) {
+		std::vector<Vector2>& p = points();
+		for (int i = 0; i < iterations; i++)
+		{
+			Vector2 sum;
+			for (auto& v : p)
+				sum += v;
+			Benchmark::keep(sum);
+		}
+	});
+
+	static const int vectorNormalize = Benchmark::add("math.vector2 normalize x1024", [](int iterations) {
+		std::vector<Vector2>& p = points();
+		for (int i = 0; i < iterations; i++)
+		{
+			float total = 0;
+			for (auto& v : p)
+				total += v.normalize().x;
+			Benchmark::keep(total);
+		}
+	});
+
+	static const int vectorTransform = Benchmark::add("math.vector2 transform x1024", [](int iterations) {
+		std::vector<Vector2>& p = points();
+		Matrix3 m;
+		m.rotate(30).scale(2, 2).translate(10, 5);
+		for (int i = 0; i < iterations; i++)
+		{
+			float total = 0;
+			for (auto v : p)
+				total += v.transform(m).y;
+			Benchmark::keep(total);
+		}
+	});
+
+	static const int matrixTranslation = Benchmark::add("math.matrix3 translation", [](int iterations) {
+		for (int i = 0; i < iterations; i++)
+		{
+			Matrix3 m = Matrix3::translation((float)i, 2);
+			Benchmark::keep(m);
+		}
+	});
+
+	static const int matrixCompose = Benchmark::add("math.matrix3 rotate scale translate", [](int iterations) {
+		for (int i = 0; i < iterations; i++)
+		{
+			Matrix3 m;
+			m.rotate((float)(i % 360)).scale(2, 2).translate(10, 5);
+			Benchmark::keep(m);
+		}
+	});
+
+	static const int matrixInverse = Benchmark::add("math.matrix3 inverse", [](int iterations) {
+		Matrix3 m;
+		m.rotate(30).scale(2, 3).translate(10, 5);
+		for (int i = 0; i < iterations; i++)
+		{
+			m = m.inv();
+			Benchmark::keep(m);
+		}
+	});
+}
@@ -0,0 +1,49 @@
+#include "Benchmark.h"
+
+#include "../Src/Framework/Graphics/SpriteBatch.h"
+#include "../Src/Framework/Graphics/Texture2D.h"
+#include "../Src/Framework/Graphics/TextureRegion.h"
+
+// vertex generation only, the bench runs headless so batches never reach a device
+
+namespace metalwalrus
+{
+	static Texture2D *benchTexture()
+	{
+		static Texture2D *tex = Texture2D::create("assets/sprite/walrus.png");
+		return tex;
+	}
+
+	static void drawSprites(int iterations, float rotation)
+	{
+		static SpriteBatch batch;
+		static TextureRegion region(benchTexture(), 0, 0, 32, 32);
+		for (int i = 0; i < iterations; i++)
+		{
+			batch.begin();
+			for (int s = 0; s < 1000; s++)
+				batch.drawreg(region, (float)(s % 40) * 8, (float)(s / 40) * 8, 1, 1, rotation);
+			batch.end();
+		}
+	}
+
+	static const int batchSprites = Benchmark::add("batching.spritebatch 1000 sprites", [](int iterations) {
+		drawSprites(iterations, 0);
+	});
+
+	static const int batchRotated = Benchmark::add("batching.spritebatch 1000 rotated sprites", [](int iterations) {
+		drawSprites(iterations, 45);
+	});
+
+	static const int batchTextures = Benchmark::add("batching.spritebatch 1000 sprites 2 textures", [](int iterations) {
+		static SpriteBatch batch;
+		static Texture2D *other = Texture2D::create("assets/sprite/bullet.png");
+		for (int i = 0; i < iterations; i++)
+		{
+			batch.begin();
+			for (int s = 0; s < 1000; s++)
+				batch.drawtex(s % 2 == 0 ? *benchTexture() : *other, (float)(s % 40) * 8, (float)(s / 40) * 8);
+			batch.end();
+		}
+	});
+}
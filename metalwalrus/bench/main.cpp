@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include "Benchmark.h"
+#include "../Src/Framework/Settings.h"
+#include "../Src/Framework/Util/Logger.h"
+
+using namespace metalwalrus;
+
+// microbenchmarks for the framework, run from the game's directory so the
+// assets resolve. --filter text runs the benchmarks whose name contains it,
+// --json path writes the results for diffing against another commit,
+// --min-ms N sets how long one sample must take, --samples N how many are
+// taken and --list prints every benchmark without running any. the checks
+// run first and the exit code is nonzero if any of them fail
+int main(int argc, char **argv)
+{
+	std::string filter;
+	std::string jsonPath;
+	double minSampleMs = 50;
+	int samples = 5;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--filter" && i + 1 < argc)
+			filter = argv[++i];
+		else if (arg == "--json" && i + 1 < argc)
+			jsonPath = argv[++i];
+		else if (arg == "--min-ms" && i + 1 < argc)
+			minSampleMs = std::stod(argv[++i]);
+		else if (arg == "--samples" && i + 1 < argc)
+			samples = std::max(1, std::stoi(argv[++i]));
+		else if (arg == "--list")
+		{
+			Benchmark::list();
+			return 0;
+		}
+	}
+
+	// textures and vertex buffers keep their data and never touch GL
+	Settings::HEADLESS = true;
+	Logger::start();
+
+	std::cout << "metalwalrus benchmarks, " << samples << " samples of at least "
+		<< minSampleMs << " ms\n";
+	int failed = Benchmark::runChecks(filter);
+	Benchmark::runAll(filter, minSampleMs, samples);
+
+	int result = failed == 0 ? 0 : 1;
+	if (!jsonPath.empty() && !Benchmark::writeJSON(jsonPath))
+	{
+		std::cerr << "could not write " << jsonPath << "\n";
+		result = 1;
+	}
+	Logger::stop();
+	return result;
+}